@@ -31,7 +31,8 @@ namespace sp
 					asio::ip::tcp::resolver resolver(m_context);
 					asio::ip::tcp::resolver::results_type endpoints = resolver.resolve(host, std::to_string(port));
 
-					m_connection = std::make_unique<connection<T>>(connection<T>::owner::client, m_context, asio::ip::tcp::socket(m_context), m_qMessagesIn);
+					m_connection = std::make_shared<connection<T>>(connection<T>::owner::client, asio::ip::tcp::socket(m_context), m_qMessagesIn);
+					m_connection->SetMaxMessageSize(m_nMaxMessageSize);
 
 					m_connection->ConnectToServer(endpoints);
 
@@ -56,7 +57,14 @@ namespace sp
 				if (thrContext.joinable())
 					thrContext.join();
 
-				m_connection.release();
+				// 남은 핸들러가 연결을 참조하고 있어도 각자 shared_ptr 로 붙잡고 있으므로 안전하게 해제
+				m_connection.reset();
+			}
+
+			// Connect 전에 호출 (이후 연결에 적용)
+			void SetMaxMessageSize(uint32_t nMaxSize)
+			{
+				m_nMaxMessageSize = nMaxSize;
 			}
 
 			bool IsConnected()
@@ -74,6 +82,12 @@ namespace sp
 					m_connection->Send(msg);
 			}
 
+			void Send(message<T>&& msg)
+			{
+				if (IsConnected())
+					m_connection->Send(std::move(msg));
+			}
+
 			tsqueue<owned_message<T>>& Incoming()
 			{
 				return m_qMessagesIn;
@@ -84,7 +98,9 @@ namespace sp
 
 			std::thread thrContext;
 
-			std::unique_ptr<connection<T>> m_connection;
+			std::shared_ptr<connection<T>> m_connection;
+
+			uint32_t m_nMaxMessageSize = connection<T>::DEFAULT_MAX_MESSAGE_SIZE;
 
 		private:
 			tsqueue<owned_message<T>> m_qMessagesIn;
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <atomic>
+#include <array>
+#include <cstring>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <deque>
 #include <optional>
 #include <vector>
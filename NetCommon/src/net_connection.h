@@ -8,9 +8,6 @@ namespace sp
 {
 	namespace net
 	{
-		template <typename T>
-		class server_interface;
-
 		template <typename T>
 		class connection : public std::enable_shared_from_this<connection<T>>
 		{
@@ -21,14 +18,22 @@ namespace sp
 				client
 			};
 
+			static constexpr size_t READ_BUFFER_SIZE = 16 * 1024;
+			static constexpr uint32_t DEFAULT_MAX_MESSAGE_SIZE = 64 * 1024;
+
 
 		public:
-			connection(owner parent, asio::io_context& asioContext, asio::ip::tcp::socket socket, tsqueue<owned_message<T>>& qIn)
-				: m_asioContext(asioContext)
-				, m_socket(std::move(socket))
+			// socket 의 executor 로 모든 핸들러를 실행 (서버는 연결마다 strand → I/O 스레드가 여러 개여도 직렬화)
+			connection(owner parent, asio::ip::tcp::socket socket, tsqueue<owned_message<T>>& qIn)
+				: m_socket(std::move(socket))
 				, m_qMessagesIn(qIn)
 			{
 				m_nOwnerType = parent;
+				m_bSocketOpen = m_socket.is_open();
+
+				m_vReadBuffer.resize(READ_BUFFER_SIZE);
+				m_vWriteBatch.reserve(MAX_WRITE_BATCH_MESSAGES);
+				m_vWriteBuffers.reserve(MAX_WRITE_BATCH_MESSAGES * 2);
 
 				if (m_nOwnerType == owner::server)
 				{
@@ -51,17 +56,29 @@ namespace sp
 				return id;
 			}
 
+			// header.size 가 이 값을 넘는 메시지를 받으면 연결 종료 (수신 시작 전에 설정)
+			void SetMaxMessageSize(uint32_t nMaxSize)
+			{
+				m_nMaxMessageSize = nMaxSize;
+			}
+
 		public:
-			void ConnectToClient(sp::net::server_interface<T>* server, uint32_t uid = 0)
+			void ConnectToClient(uint32_t uid = 0)
 			{
 				if (m_nOwnerType == owner::server)
 				{
 					if (m_socket.is_open())
 					{
 						id = uid;
-						
-						WriteValidation();
-						ReadValidation(server);
+
+						// 핸드셰이크 읽기/쓰기 시작도 이 연결의 strand 안에서
+						asio::dispatch(m_socket.get_executor(), [this, self = this->shared_from_this()]()
+							{
+								DisableNagle();
+
+								WriteValidation();
+								ReadValidation();
+							});
 					}
 				}
 			}
@@ -71,10 +88,12 @@ namespace sp
 				if (m_nOwnerType == owner::client)
 				{
 					asio::async_connect(m_socket, endPoints,
-						[this](std::error_code ec, asio::ip::tcp::endpoint endpoint)
+						[this, self = this->shared_from_this()](std::error_code ec, asio::ip::tcp::endpoint endpoint)
 						{
 							if (!ec)
 							{
+								m_bSocketOpen = true;
+								DisableNagle();
 								ReadValidation();
 							}
 						});
@@ -83,19 +102,23 @@ namespace sp
 
 			void Disconnect()
 			{
-				// ߺ Disconnect 
-				if (!m_bAlive)
+				// 중복 Disconnect 방지 (메인 스레드 / I/O 스레드 어디서든 호출 가능)
+				if (!m_bAlive.exchange(false))
 					return;
 
-				m_bAlive = false;
+				// 서버: 연결 해제도 수신 큐로 전달 → 메인 스레드가 바로 깨어나 처리
+				if (m_nOwnerType == owner::server)
+					m_qMessagesIn.push_back({ this->shared_from_this(), {}, net_event::disconnected });
 
-				if (IsConnected())
-					asio::post(m_asioContext, [this]() 
+				if (m_bSocketOpen)
+					asio::post(m_socket.get_executor(), [this, self = this->shared_from_this()]()
 						{
+							m_bSocketOpen = false;
+
 							std::error_code ec;
 							m_socket.cancel(ec);
 
-							// б/  
+							// 읽기/쓰기 모두 종료
 							m_socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
 							
 							m_socket.close();
@@ -105,7 +128,7 @@ namespace sp
 
 			bool IsConnected() const
 			{
-				return m_bAlive && m_socket.is_open();
+				return m_bAlive && m_bSocketOpen;
 			}
 
 			void StartListening()
@@ -116,131 +139,225 @@ namespace sp
 		public:
 			void Send(const message<T>& msg)
 			{
-				asio::post(m_asioContext,
-					[this, msg]()
+				Send(message<T>(msg));
+			}
+
+			// 보낸 뒤 msg 를 다시 쓰지 않으면 이쪽 사용 (body 복사 없음)
+			void Send(message<T>&& msg)
+			{
+				asio::post(m_socket.get_executor(),
+					[this, self = this->shared_from_this(), msg = std::move(msg)]() mutable
 					{
 						if (!m_bAlive)
 							return;
 
-						bool bWritingMessage = !m_qMessagesOut.empty();
-						m_qMessagesOut.push_back(msg);
-						if (!bWritingMessage)
+						m_qMessagesOut.push_back({ std::move(msg), nullptr });
+
+						// 진행 중인 쓰기가 있으면 완료 핸들러가 이어서 보냄
+						if (m_vWriteBatch.empty())
 						{
-							WriteHeader();
+							WriteBatch();
 						}
 					});
 			}
 
-		private:
-			void WriteHeader()
+			// 브로드캐스트: 여러 연결이 같은 버퍼를 참조 (연결마다 복사하지 않음)
+			void Send(shared_message<T> pMsg)
 			{
-				if (!m_bAlive)
-					return;
-
-				asio::async_write(m_socket, asio::buffer(&m_qMessagesOut.front().header, sizeof(message_header<T>)),
-					[this](std::error_code ec, std::size_t length)
+				asio::post(m_socket.get_executor(),
+					[this, self = this->shared_from_this(), pMsg = std::move(pMsg)]() mutable
 					{
 						if (!m_bAlive)
 							return;
 
-						if (!ec)
-						{
-							if (m_qMessagesOut.front().body.size() > 0)
-							{
-								WriteBody();
-							}
-							else
-							{
-								m_qMessagesOut.pop_front();
+						m_qMessagesOut.push_back({ message<T>{}, std::move(pMsg) });
 
-								if (!m_qMessagesOut.empty())
-								{
-									WriteHeader();
-								}
-							}
-						}
-						else
+						if (m_vWriteBatch.empty())
 						{
-							std::cout << "[" << id << "] Write Header Fail.\n";
-							Disconnect();
+							WriteBatch();
 						}
 					});
 			}
 
-			void WriteBody()
+		private:
+			// 작은 게임 패킷이 이전 세그먼트의 ACK 를 기다리며 묶이지 않도록 (지연 ACK 와 겹치면 수십 ms 정체)
+			// 묶어 보내기는 WriteBatch 가 담당
+			void DisableNagle()
+			{
+				std::error_code ec;
+				m_socket.set_option(asio::ip::tcp::no_delay(true), ec);
+			}
+
+			// 한 번의 async_write 로 보낼 최대 메시지 수 / 바이트
+			// 메시지당 버퍼 2개 (header + body) → 32개면 asio 의 writev 버퍼 상한(64) 안에서 한 번에 전송
+			static constexpr size_t MAX_WRITE_BATCH_MESSAGES = 32;
+			static constexpr size_t MAX_WRITE_BATCH_BYTES = 64 * 1024;
+
+			// 전송 대기 메시지: 단일 전송은 직접 소유, 브로드캐스트는 공유 버퍼 참조
+			struct outgoing_message
+			{
+				message<T> msg;
+				shared_message<T> pShared;
+
+				const message<T>& get() const
+				{
+					return pShared ? *pShared : msg;
+				}
+			};
+
+			// 큐에 쌓인 메시지를 묶어 header / body 를 하나의 scatter/gather 버퍼열로 전송
+			void WriteBatch()
 			{
 				if (!m_bAlive)
 					return;
 
-				asio::async_write(m_socket, asio::buffer(m_qMessagesOut.front().body.data(), m_qMessagesOut.front().body.size()),
-					[this](std::error_code ec, std::size_t length)
+				size_t nBatchBytes = 0;
+				while (!m_qMessagesOut.empty() && m_vWriteBatch.size() < MAX_WRITE_BATCH_MESSAGES)
+				{
+					// 상한보다 큰 메시지도 단독으로는 전송
+					const size_t nMsgBytes = m_qMessagesOut.front().get().size();
+					if (!m_vWriteBatch.empty() && nBatchBytes + nMsgBytes > MAX_WRITE_BATCH_BYTES)
+						break;
+
+					m_vWriteBatch.push_back(m_qMessagesOut.pop_front());
+					nBatchBytes += nMsgBytes;
+				}
+
+				if (m_vWriteBatch.empty())
+					return;
+
+				m_vWriteBuffers.clear();
+				for (auto& out : m_vWriteBatch)
+				{
+					const message<T>& msg = out.get();
+					m_vWriteBuffers.push_back(asio::buffer(&msg.header, sizeof(message_header<T>)));
+					if (!msg.body.empty())
+						m_vWriteBuffers.push_back(asio::buffer(msg.body.data(), msg.body.size()));
+				}
+
+				asio::async_write(m_socket, m_vWriteBuffers,
+					[this, self = this->shared_from_this()](std::error_code ec, std::size_t length)
 					{
 						if (!m_bAlive)
 							return;
 
 						if (!ec)
 						{
-							m_qMessagesOut.pop_front();
+							m_vWriteBatch.clear();
 
 							if (!m_qMessagesOut.empty())
 							{
-								WriteHeader();
+								WriteBatch();
 							}
 						}
 						else
 						{
-							std::cout << "[" << id << "] Write Body Fail.\n";
+							std::cout << "[" << id << "] Write Fail.\n";
 							Disconnect();
 						}
-					}
-				);
+					});
 			}
 
-			void ReadHeader()
+			// 수신 버퍼에 읽을 수 있는 만큼 읽고, 완성된 프레임을 모두 꺼낸 뒤 다시 읽기 시작
+			// (header 8바이트마다 async_read 를 따로 하지 않음)
+			void ReadMessages()
 			{
 				if (!m_bAlive)
 					return;
 
-				asio::async_read(m_socket, asio::buffer(&m_msgTemporaryIn.header, sizeof(message_header<T>)),
-					[this](std::error_code ec, std::size_t length)
+				// 이미 꺼낸 앞부분을 버리고 남은 조각을 버퍼 앞으로 당김
+				if (m_nReadBegin > 0)
+				{
+					std::memmove(m_vReadBuffer.data(), m_vReadBuffer.data() + m_nReadBegin, m_nReadEnd - m_nReadBegin);
+					m_nReadEnd -= m_nReadBegin;
+					m_nReadBegin = 0;
+				}
+
+				m_socket.async_read_some(asio::buffer(m_vReadBuffer.data() + m_nReadEnd, m_vReadBuffer.size() - m_nReadEnd),
+					[this, self = this->shared_from_this()](std::error_code ec, std::size_t length)
 					{
 						if (!m_bAlive)
 							return;
 
 						if (!ec)
 						{
-							if (m_msgTemporaryIn.header.size > 0)
-							{
-								m_msgTemporaryIn.body.resize(m_msgTemporaryIn.header.size);
-								ReadBody();
-							}
-							else
-							{
-								AddToInCommingMessageQueue();
-							}
+							m_nReadEnd += length;
+							ParseMessages();
 						}
 						else
 						{
-							std::cout << "[" << id << "] Read Header Fail.\n";
+							std::cout << "[" << id << "] Read Fail.\n";
 							Disconnect();
 						}
 					});
 			}
 
-			void ReadBody()
+			void ParseMessages()
 			{
-				if (!m_bAlive)
-					return;
+				constexpr size_t nHeaderSize = sizeof(message_header<T>);
+
+				while (m_nReadEnd - m_nReadBegin >= nHeaderSize)
+				{
+					message_header<T> header;
+					std::memcpy(&header, m_vReadBuffer.data() + m_nReadBegin, nHeaderSize);
+
+					if (header.size > m_nMaxMessageSize)
+					{
+						std::cout << "[" << id << "] Message Too Large (" << header.size << " bytes).\n";
+						Disconnect();
+						return;
+					}
 
-				asio::async_read(m_socket, asio::buffer(m_msgTemporaryIn.body.data(), m_msgTemporaryIn.body.size()),
-					[this](std::error_code ec, std::size_t length)
+					const size_t nFrameSize = nHeaderSize + header.size;
+					if (m_nReadEnd - m_nReadBegin < nFrameSize)
+					{
+						// 수신 버퍼보다 큰 body 는 나머지를 body 로 직접 읽음
+						if (nFrameSize > m_vReadBuffer.size())
+						{
+							ReadLargeBody(header);
+							return;
+						}
+
+						break;
+					}
+
+					message<T> msg;
+					msg.header = header;
+
+					const uint8_t* pBody = m_vReadBuffer.data() + m_nReadBegin + nHeaderSize;
+					msg.body.assign(pBody, pBody + header.size);
+
+					m_nReadBegin += nFrameSize;
+
+					AddToInCommingMessageQueue(std::move(msg));
+				}
+
+				ReadMessages();
+			}
+
+			void ReadLargeBody(const message_header<T>& header)
+			{
+				const size_t nBuffered = m_nReadEnd - m_nReadBegin - sizeof(message_header<T>);
+
+				m_msgTemporaryIn.header = header;
+				m_msgTemporaryIn.body.resize(header.size);
+				std::memcpy(m_msgTemporaryIn.body.data(), m_vReadBuffer.data() + m_nReadBegin + sizeof(message_header<T>), nBuffered);
+
+				m_nReadBegin = 0;
+				m_nReadEnd = 0;
+
+				asio::async_read(m_socket, asio::buffer(m_msgTemporaryIn.body.data() + nBuffered, header.size - nBuffered),
+					[this, self = this->shared_from_this()](std::error_code ec, std::size_t length)
 					{
 						if (!m_bAlive)
 							return;
 
 						if (!ec)
 						{
-							AddToInCommingMessageQueue();
+							AddToInCommingMessageQueue(std::move(m_msgTemporaryIn));
+							m_msgTemporaryIn = {};
+
+							ReadMessages();
 						}
 						else
 						{
@@ -250,21 +367,19 @@ namespace sp
 					});
 			}
 
-			void AddToInCommingMessageQueue()
+			void AddToInCommingMessageQueue(message<T>&& msg)
 			{
 				if (!m_bAlive)
 					return;
 
 				if (m_nOwnerType == owner::server)
 				{
-					m_qMessagesIn.push_back({ this->shared_from_this(), m_msgTemporaryIn });
+					m_qMessagesIn.push_back({ this->shared_from_this(), std::move(msg) });
 				}
 				else
 				{
-					m_qMessagesIn.push_back({ nullptr, m_msgTemporaryIn });
+					m_qMessagesIn.push_back({ nullptr, std::move(msg) });
 				}
-
-				ReadHeader();
 			}
 
 			static constexpr uint64_t SCRAMBLE_KEY = 0xA3B1C5D7E9F01234ULL;
@@ -281,7 +396,7 @@ namespace sp
 			void WriteValidation()
 			{
 				asio::async_write(m_socket, asio::buffer(&m_nHandshakeOut, sizeof(uint64_t)),
-					[this](std::error_code ec, std::size_t length)
+					[this, self = this->shared_from_this()](std::error_code ec, std::size_t length)
 					{
 						if (!ec)
 						{
@@ -289,7 +404,7 @@ namespace sp
 								return;
 
 							if (m_nOwnerType == owner::client)
-								ReadHeader();
+								ReadMessages();
 						}
 						else
 						{
@@ -298,10 +413,10 @@ namespace sp
 					});
 			}
 
-			void ReadValidation(sp::net::server_interface<T>* server = nullptr)
+			void ReadValidation()
 			{
 				asio::async_read(m_socket, asio::buffer(&m_nHandshakeIn, sizeof(uint64_t)),
-					[this, server](std::error_code ec, std::size_t length)
+					[this, self = this->shared_from_this()](std::error_code ec, std::size_t length)
 					{
 						if (!ec)
 						{
@@ -310,9 +425,10 @@ namespace sp
 								if (m_nHandshakeIn == m_nHandshakeCheck)
 								{
 									std::cout << "Client Validated" << std::endl;
-									server->OnClientValidated(this->shared_from_this());
+									// OnClientValidated 는 메인 스레드에서 (메시지보다 먼저 큐에 들어감)
+									m_qMessagesIn.push_back({ this->shared_from_this(), {}, net_event::validated });
 
-									ReadHeader();
+									ReadMessages();
 								}
 								else
 								{
@@ -336,11 +452,18 @@ namespace sp
 
 		protected:
 			asio::ip::tcp::socket m_socket;
-			asio::io_context& m_asioContext;
 
-			tsqueue<message<T>> m_qMessagesOut;
+			tsqueue<outgoing_message> m_qMessagesOut;
+			std::vector<outgoing_message> m_vWriteBatch;				// 전송 중인 메시지 (완료 전까지 버퍼 유지)
+			std::vector<asio::const_buffer> m_vWriteBuffers;
 			tsqueue<owned_message<T>>& m_qMessagesIn;
-			message<T> m_msgTemporaryIn;
+			message<T> m_msgTemporaryIn;							// 수신 버퍼보다 큰 메시지 조립용
+
+			// 수신 버퍼: [m_nReadBegin, m_nReadEnd) 가 아직 꺼내지 않은 바이트
+			std::vector<uint8_t> m_vReadBuffer;
+			size_t m_nReadBegin = 0;
+			size_t m_nReadEnd = 0;
+			uint32_t m_nMaxMessageSize = DEFAULT_MAX_MESSAGE_SIZE;
 			owner m_nOwnerType = owner::server;
 			uint32_t id = 0;
 
@@ -350,7 +473,9 @@ namespace sp
 			uint64_t m_nHandshakeIn = 0;
 			uint64_t m_nHandshakeCheck = 0;
 
-			bool m_bAlive = true;
+			// 메인 스레드(IsConnected / Disconnect)와 I/O 스레드가 함께 읽음
+			std::atomic<bool> m_bAlive{ true };
+			std::atomic<bool> m_bSocketOpen{ false };
 		};
 	}
 }
\ No newline at end of file
@@ -13,11 +13,218 @@ namespace sp
 			uint32_t size = 0;
 		};
 
+		// ------------------------------------------------------------
+		//  message body 용 힙 블록 풀 (스레드별)
+		//  256B ~ 64KB 를 2의 거듭제곱 크기로 나눠 해제된 블록을 재사용
+		//  다른 스레드에서 받은 블록도 해제한 스레드의 풀로 들어감
+		// ------------------------------------------------------------
+		class body_pool
+		{
+		public:
+			static constexpr size_t MIN_BLOCK_SIZE = 256;
+			static constexpr size_t MAX_BLOCK_SIZE = 64 * 1024;
+			static constexpr size_t MAX_CACHED_PER_CLASS = 32;
+
+			// nCapacity 이상인 블록 반환 (nCapacity 는 실제 블록 크기로 갱신)
+			static uint8_t* acquire(size_t& nCapacity)
+			{
+				if (nCapacity > MAX_BLOCK_SIZE)
+					return new uint8_t[nCapacity];
+
+				size_t nBlock = MIN_BLOCK_SIZE;
+				size_t nClass = 0;
+				while (nBlock < nCapacity)
+				{
+					nBlock <<= 1;
+					++nClass;
+				}
+
+				nCapacity = nBlock;
+
+				auto& list = local().lists[nClass];
+				if (list.empty())
+					return new uint8_t[nBlock];
+
+				uint8_t* p = list.back();
+				list.pop_back();
+				return p;
+			}
+
+			static void release(uint8_t* p, size_t nCapacity)
+			{
+				if (nCapacity <= MAX_BLOCK_SIZE)
+				{
+					size_t nClass = 0;
+					for (size_t nBlock = MIN_BLOCK_SIZE; nBlock < nCapacity; nBlock <<= 1)
+						++nClass;
+
+					auto& list = local().lists[nClass];
+					if (list.size() < MAX_CACHED_PER_CLASS)
+					{
+						list.push_back(p);
+						return;
+					}
+				}
+
+				delete[] p;
+			}
+
+		private:
+			static constexpr size_t CLASS_COUNT = 9;	// 256, 512, ..., 64KB
+
+			struct free_lists
+			{
+				std::array<std::vector<uint8_t*>, CLASS_COUNT> lists;
+
+				~free_lists()
+				{
+					for (auto& list : lists)
+						for (uint8_t* p : list)
+							delete[] p;
+				}
+			};
+
+			static free_lists& local()
+			{
+				thread_local free_lists s_lists;
+				return s_lists;
+			}
+		};
+
+		// ------------------------------------------------------------
+		//  message body 버퍼
+		//  INLINE_CAPACITY 이하는 객체 안에 저장 (게임 패킷은 전부 여기에 들어감)
+		//  더 크면 body_pool 블록 사용. 새로 늘어난 바이트는 초기화하지 않음
+		// ------------------------------------------------------------
+		class message_body
+		{
+		public:
+			static constexpr size_t INLINE_CAPACITY = 192;
+
+			message_body() noexcept {}		// 인라인 버퍼는 초기화하지 않음
+
+			message_body(const message_body& other)
+			{
+				assign(other.data(), other.data() + other.size());
+			}
+
+			message_body(message_body&& other) noexcept
+			{
+				steal(other);
+			}
+
+			message_body& operator=(const message_body& other)
+			{
+				if (this != &other)
+					assign(other.data(), other.data() + other.size());
+				return *this;
+			}
+
+			message_body& operator=(message_body&& other) noexcept
+			{
+				if (this != &other)
+				{
+					free_heap();
+					steal(other);
+				}
+				return *this;
+			}
+
+			~message_body()
+			{
+				free_heap();
+			}
+
+		public:
+			uint8_t* data() { return m_pHeap ? m_pHeap : m_inline; }
+			const uint8_t* data() const { return m_pHeap ? m_pHeap : m_inline; }
+
+			size_t size() const { return m_nSize; }
+			size_t capacity() const { return m_nCapacity; }
+			bool empty() const { return m_nSize == 0; }
+
+			uint8_t& operator[](size_t i) { return data()[i]; }
+			const uint8_t& operator[](size_t i) const { return data()[i]; }
+
+			void reserve(size_t nCapacity)
+			{
+				if (nCapacity <= m_nCapacity)
+					return;
+
+				uint8_t* pNew = body_pool::acquire(nCapacity);
+				std::memcpy(pNew, data(), m_nSize);
+
+				free_heap();
+				m_pHeap = pNew;
+				m_nCapacity = nCapacity;
+			}
+
+			void resize(size_t nSize)
+			{
+				if (nSize > m_nCapacity)
+					reserve(std::max(nSize, m_nCapacity * 2));
+
+				m_nSize = nSize;
+			}
+
+			// 용량은 유지
+			void clear()
+			{
+				m_nSize = 0;
+			}
+
+			void assign(const uint8_t* first, const uint8_t* last)
+			{
+				const size_t nSize = static_cast<size_t>(last - first);
+
+				m_nSize = 0;
+				resize(nSize);
+				std::memcpy(data(), first, nSize);
+			}
+
+		private:
+			void steal(message_body& other)
+			{
+				if (other.m_pHeap)
+				{
+					m_pHeap = other.m_pHeap;
+					m_nCapacity = other.m_nCapacity;
+				}
+				else
+				{
+					m_pHeap = nullptr;
+					m_nCapacity = INLINE_CAPACITY;
+					std::memcpy(m_inline, other.m_inline, other.m_nSize);
+				}
+
+				m_nSize = other.m_nSize;
+
+				other.m_pHeap = nullptr;
+				other.m_nSize = 0;
+				other.m_nCapacity = INLINE_CAPACITY;
+			}
+
+			void free_heap()
+			{
+				if (m_pHeap)
+					body_pool::release(m_pHeap, m_nCapacity);
+
+				m_pHeap = nullptr;
+				m_nCapacity = INLINE_CAPACITY;
+			}
+
+		private:
+			uint8_t* m_pHeap = nullptr;
+			size_t m_nSize = 0;
+			size_t m_nCapacity = INLINE_CAPACITY;
+			uint8_t m_inline[INLINE_CAPACITY];
+		};
+
 		template <typename T>
 		struct message
 		{
 			message_header<T> header{};
-			std::vector<uint8_t> body;
+			message_body body;
 
 			size_t size() const
 			{
@@ -58,14 +265,27 @@ namespace sp
 			}
 		};
 
+		// 여러 연결의 송신 큐가 함께 참조하는 불변 메시지 (브로드캐스트용)
+		template <typename T>
+		using shared_message = std::shared_ptr<const message<T>>;
+
 		template <typename T>
 		class connection;
 		
+		// I/O 스레드 → 메인 스레드 이벤트 종류 (수신 큐 하나로 순서대로 전달)
+		enum class net_event : uint8_t
+		{
+			message,		// msg 에 수신 메시지
+			validated,		// remote 가 핸드셰이크 통과 (msg 비어 있음)
+			disconnected	// remote 연결 종료 (msg 비어 있음)
+		};
+
 		template <typename T>
 		struct owned_message
 		{
 			std::shared_ptr<connection<T>> remote = nullptr;
 			message<T> msg;
+			net_event event = net_event::message;
 
 			friend std::ostream& operator<<(std::ostream& os, const owned_message<T>& msg)
 			{
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "net_common.h"
+
+namespace sp
+{
+	namespace net
+	{
+		// ------------------------------------------------------------
+		//  락 없는 다중 생산자 / 단일 소비자 큐
+		//
+		//  - push: 노드를 스택 head 에 CAS 로 연결 (락 없음)
+		//  - drain_into: head 를 통째로 떼어내 뒤집은 뒤 한 번에 꺼냄 (생산자별 순서 유지)
+		//  - 노드는 CHUNK_SIZE 개씩 묶어 할당하고, 소비자가 꺼낸 노드는 free list 로 돌려 생산자가 재사용
+		//    free list head 는 (tag, index) 를 64비트 하나에 묶어 CAS → 같은 노드가 돌아와도 ABA 없음
+		//    풀이 MAX_CHUNKS 까지 찬 뒤에만 노드를 개별 new / delete
+		//  - wait: 소비자가 실제로 잠들 때만 mutex / condition_variable 사용
+		//    생산자는 소비자가 잠들어 있을 때만 깨우므로 평소 push 에는 커널 호출이 없음
+		//
+		//  - notify: 항목 없이 소비자만 깨움 (연결 해제 등 큐 밖의 이벤트)
+		//
+		//  drain_into / wait / wait_until / empty 는 소비자 스레드 하나에서만 호출
+		// ------------------------------------------------------------
+		template <typename T>
+		class mpsc_queue
+		{
+		public:
+			mpsc_queue() = default;
+			mpsc_queue(const mpsc_queue<T>&) = delete;
+
+			~mpsc_queue()
+			{
+				node* pNode = m_pHead.exchange(nullptr);
+				while (pNode)
+				{
+					node* pNext = pNode->pNext;
+					if (pNode->nIndex == NO_INDEX)
+						delete pNode;
+					pNode = pNext;
+				}
+
+				for (auto& chunk : m_Chunks)
+					delete[] chunk.load();
+			}
+
+		public:
+			void push(const T& item)
+			{
+				node* pNode = acquire();
+				pNode->value = item;
+				link(pNode);
+			}
+
+			void push(T&& item)
+			{
+				node* pNode = acquire();
+				pNode->value = std::move(item);
+				link(pNode);
+			}
+
+			// 쌓인 항목을 전부 out 뒤에 들어온 순서대로 추가하고 개수 반환
+			size_t drain_into(std::vector<T>& out)
+			{
+				node* pNode = m_pHead.exchange(nullptr, std::memory_order_acquire);
+
+				// 스택은 최신 항목이 앞 → 뒤집어서 FIFO 로
+				node* pReversed = nullptr;
+				size_t nCount = 0;
+				while (pNode)
+				{
+					node* pNext = pNode->pNext;
+					pNode->pNext = pReversed;
+					pReversed = pNode;
+					pNode = pNext;
+					++nCount;
+				}
+
+				out.reserve(out.size() + nCount);
+				while (pReversed)
+				{
+					node* pNext = pReversed->pNext;
+					out.push_back(std::move(pReversed->value));
+					release(pReversed);
+					pReversed = pNext;
+				}
+
+				return nCount;
+			}
+
+			bool empty() const
+			{
+				return m_pHead.load(std::memory_order_acquire) == nullptr;
+			}
+
+			// 항목이 들어오거나 notify 될 때까지 대기
+			void wait()
+			{
+				if (!empty() || m_bNotified.exchange(false))
+					return;
+
+				std::unique_lock<std::mutex> lock(m_muxPark);
+
+				// push 의 CAS 와 seq_cst 로 순서가 정해짐: 생산자가 bParked 를 못 봤다면 아래 조건 검사가 항목을 봄
+				m_bParked.store(true);
+				m_cvPark.wait(lock, [this]() { return IsReady(); });
+				Unpark();
+			}
+
+			// wait 와 같지만 tpDeadline 이 지나면 항목이 없어도 반환
+			void wait_until(const std::chrono::steady_clock::time_point& tpDeadline)
+			{
+				if (!empty() || m_bNotified.exchange(false))
+					return;
+
+				std::unique_lock<std::mutex> lock(m_muxPark);
+
+				m_bParked.store(true);
+				m_cvPark.wait_until(lock, tpDeadline, [this]() { return IsReady(); });
+				Unpark();
+			}
+
+			// 어느 스레드에서나 호출: 잠든 소비자를 깨움 (깨어 있으면 다음 wait 한 번을 건너뜀)
+			void notify()
+			{
+				m_bNotified.store(true);
+				Wake();
+			}
+
+		private:
+			static constexpr uint32_t CHUNK_SIZE = 32;
+			static constexpr uint32_t MAX_CHUNKS = 64;	// 재사용 노드 최대 2048 개
+			static constexpr uint32_t NO_INDEX = 0xFFFFFFFF;
+
+			struct node
+			{
+				T value{};
+				node* pNext = nullptr;
+				uint32_t nIndex = NO_INDEX;				// 풀 안의 번호 (NO_INDEX 면 개별 할당)
+				std::atomic<uint32_t> nFreeNext{ NO_INDEX };	// free list 의 다음 노드 번호
+			};
+
+			static uint64_t PackFree(uint32_t nTag, uint32_t nIndex)
+			{
+				return (static_cast<uint64_t>(nTag) << 32) | nIndex;
+			}
+
+			node* NodeAt(uint32_t nIndex) const
+			{
+				return &m_Chunks[nIndex / CHUNK_SIZE].load(std::memory_order_acquire)[nIndex % CHUNK_SIZE];
+			}
+
+			// 생산자: free list 에서 노드를 꺼내고, 비었으면 청크를 새로 붙임
+			node* acquire()
+			{
+				uint64_t nHead = m_nFreeHead.load(std::memory_order_acquire);
+				while (static_cast<uint32_t>(nHead) != NO_INDEX)
+				{
+					// 다른 생산자가 먼저 꺼냈다면 nNext 는 틀릴 수 있지만 tag 가 달라져 CAS 가 실패함
+					node* pNode = NodeAt(static_cast<uint32_t>(nHead));
+					const uint32_t nNext = pNode->nFreeNext.load(std::memory_order_relaxed);
+
+					if (m_nFreeHead.compare_exchange_weak(nHead, PackFree(static_cast<uint32_t>(nHead >> 32) + 1, nNext),
+						std::memory_order_acquire, std::memory_order_acquire))
+						return pNode;
+				}
+
+				const uint32_t nChunk = m_nChunkCount.fetch_add(1, std::memory_order_relaxed);
+				if (nChunk >= MAX_CHUNKS)
+				{
+					m_nChunkCount.fetch_sub(1, std::memory_order_relaxed);
+					return new node();
+				}
+
+				node* pChunk = new node[CHUNK_SIZE];
+				for (uint32_t i = 0; i < CHUNK_SIZE; ++i)
+				{
+					pChunk[i].nIndex = nChunk * CHUNK_SIZE + i;
+					pChunk[i].nFreeNext.store(i + 1 < CHUNK_SIZE ? pChunk[i].nIndex + 1 : NO_INDEX, std::memory_order_relaxed);
+				}
+				m_Chunks[nChunk].store(pChunk, std::memory_order_release);
+
+				// 첫 노드는 직접 쓰고 나머지 [1..CHUNK_SIZE) 를 free list 에 연결
+				push_free(pChunk[1], pChunk[CHUNK_SIZE - 1]);
+				return &pChunk[0];
+			}
+
+			// 소비자: 꺼낸 노드를 free list 로 돌려줌
+			void release(node* pNode)
+			{
+				if (pNode->nIndex == NO_INDEX)
+				{
+					delete pNode;
+					return;
+				}
+
+				push_free(*pNode, *pNode);
+			}
+
+			// first → ... → last 로 이미 이어진 노드열을 free list 앞에 연결
+			void push_free(node& first, node& last)
+			{
+				uint64_t nHead = m_nFreeHead.load(std::memory_order_relaxed);
+				do
+				{
+					last.nFreeNext.store(static_cast<uint32_t>(nHead), std::memory_order_relaxed);
+				} while (!m_nFreeHead.compare_exchange_weak(nHead, PackFree(static_cast<uint32_t>(nHead >> 32) + 1, first.nIndex),
+					std::memory_order_release, std::memory_order_relaxed));
+			}
+
+			void link(node* pNode)
+			{
+				pNode->pNext = m_pHead.load(std::memory_order_relaxed);
+				while (!m_pHead.compare_exchange_weak(pNode->pNext, pNode))
+				{
+				}
+
+				Wake();
+			}
+
+			// 소비자가 잠들어 있을 때만 깨움
+			void Wake()
+			{
+				if (m_bParked.load())
+				{
+					std::lock_guard<std::mutex> lock(m_muxPark);
+					m_cvPark.notify_one();
+				}
+			}
+
+			bool IsReady() const
+			{
+				return m_pHead.load() != nullptr || m_bNotified.load();
+			}
+
+			void Unpark()
+			{
+				m_bParked.store(false, std::memory_order_relaxed);
+				m_bNotified.store(false, std::memory_order_relaxed);
+			}
+
+		private:
+			std::atomic<node*> m_pHead{ nullptr };
+
+			// 노드 풀 (청크는 큐가 없어질 때까지 유지)
+			std::atomic<uint64_t> m_nFreeHead{ PackFree(0, NO_INDEX) };
+			std::atomic<uint32_t> m_nChunkCount{ 0 };
+			std::array<std::atomic<node*>, MAX_CHUNKS> m_Chunks{};
+
+			std::atomic<bool> m_bParked{ false };
+			std::atomic<bool> m_bNotified{ false };
+			std::mutex m_muxPark;
+			std::condition_variable m_cvPark;
+		};
+	}
+}
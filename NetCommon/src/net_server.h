@@ -13,15 +13,23 @@ namespace sp
 		class server_interface
 		{
 		public:
-			server_interface(uint16_t port)
+			// nIoThreads 개 스레드가 하나의 io_context 를 함께 실행
+			// 연결마다 strand 를 두므로 한 연결의 핸들러는 동시에 실행되지 않고, 비어 있는 스레드가 다음 핸들러를 가져감
+			server_interface(uint16_t port, size_t nIoThreads = 1)
 				: m_asioAcceptor(m_asioContext, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port))
 			{
-
+				m_nIoThreads = std::max<size_t>(nIoThreads, 1);
 			}
 
 			virtual ~server_interface()
 			{
 				Stop();
+
+				// 연결(소켓)은 io_context 보다 먼저 해제되어야 함 → 멤버 소멸 순서에 맡기지 않고 여기서 비움
+				m_qMessagesIn.clear();
+				m_qNewConnections.clear();
+				m_vConnections.clear();
+				m_mapConnectionIndex.clear();
 			}
 
 			bool Start()
@@ -30,7 +38,8 @@ namespace sp
 				{
 					WaitForClientConnection();
 
-					m_threadContext = std::thread([this]() {m_asioContext.run(); });
+					for (size_t i = 0; i < m_nIoThreads; ++i)
+						m_vIoThreads.emplace_back([this]() {m_asioContext.run(); });
 				}
 				catch (std::exception& e)
 				{
@@ -46,15 +55,19 @@ namespace sp
 			{
 				m_asioContext.stop();
 
-				if (m_threadContext.joinable())
-					m_threadContext.join();
+				for (auto& thread : m_vIoThreads)
+				{
+					if (thread.joinable())
+						thread.join();
+				}
+				m_vIoThreads.clear();
 
 				std::cout << "[SERVER] Stopped!\n";
 			}
 
 			void WaitForClientConnection()
 			{
-				m_asioAcceptor.async_accept(
+				m_asioAcceptor.async_accept(asio::make_strand(m_asioContext),
 					[this](std::error_code ec, asio::ip::tcp::socket socket)
 					{
 						if (!ec)
@@ -62,15 +75,17 @@ namespace sp
 							std::cout << "[SERVER] New Connection: " << socket.remote_endpoint() << "\n";
 
 							std::shared_ptr<connection<T>> newClient =
-								std::make_shared<connection<T>>(connection<T>::owner::server, m_asioContext, std::move(socket), m_qMessagesIn);
+								std::make_shared<connection<T>>(connection<T>::owner::server, std::move(socket), m_qMessagesIn);
 
 							if (OnClientConnect(newClient))
 							{
-								m_deqConnections.push_back(std::move(newClient));
+								newClient->ConnectToClient(nIDCounter++);
 
-								m_deqConnections.back()->ConnectToClient(this, nIDCounter++);
+								std::cout << "[" << newClient->GetID() << "] Connection Approved\n";
 
-								std::cout << "[" << m_deqConnections.back()->GetID() << "] Connection Approved\n";
+								// m_vConnections 는 메인 스레드 전용 → 다음 Update 에서 합류
+								m_qNewConnections.push_back(std::move(newClient));
+								m_qMessagesIn.notify();
 							}
 							else
 							{
@@ -94,62 +109,117 @@ namespace sp
 				}
 			}
 
+			void MessageClient(std::shared_ptr<connection<T>> client, message<T>&& msg)
+			{
+				if (client && client->IsConnected())
+				{
+					client->Send(std::move(msg));
+				}
+			}
+
+			// 메시지를 한 번만 공유 버퍼로 만들고 모든 연결이 참조 (클라이언트 수만큼 복사하지 않음)
 			void MessageAllClients(const message<T>& msg, std::shared_ptr<connection<T>> pIgnoreClient = nullptr)
 			{
-				for (auto& client : m_deqConnections)
+				MessageAllClients(std::make_shared<const message<T>>(msg), pIgnoreClient);
+			}
+
+			void MessageAllClients(message<T>&& msg, std::shared_ptr<connection<T>> pIgnoreClient = nullptr)
+			{
+				MessageAllClients(std::make_shared<const message<T>>(std::move(msg)), pIgnoreClient);
+			}
+
+			void MessageAllClients(const shared_message<T>& pMsg, std::shared_ptr<connection<T>> pIgnoreClient = nullptr)
+			{
+				for (auto& client : m_vConnections)
 				{
 					if (client && client->IsConnected())
 					{
 						if (client != pIgnoreClient)
-							client->Send(msg);
+							client->Send(pMsg);
 					}
 				}
 			}
 
+			// 수신 큐의 이벤트를 들어온 순서대로 On* 콜백으로 전달 (모든 콜백은 이 함수를 부른 스레드에서 실행)
+			// bWait: 메시지 / 새 연결 / 연결 해제가 생기거나 GetNextWakeTime() 이 될 때까지 잠듦
 			void Update(size_t nMaxMessages = -1, bool bWait = false)
 			{
-				if (bWait)
-					m_qMessagesIn.wait();
-
-				size_t nMessageCount = 0;
-				while (nMessageCount < nMaxMessages && !m_qMessagesIn.empty())
+				// 핸드셰이크 중에 끊긴 연결은 disconnected 이벤트가 먼저 처리됐을 수 있으므로 합류시키지 않음
+				while (!m_qNewConnections.empty())
 				{
-					auto msg = m_qMessagesIn.pop_front();
-
-					OnMessage(msg.remote, msg.msg);
+					auto newClient = m_qNewConnections.pop_front();
+					if (newClient->IsConnected())
+						AddConnection(std::move(newClient));
+				}
 
-					nMessageCount++;
+				if (bWait)
+				{
+					const auto tpWake = GetNextWakeTime();
+					if (tpWake == std::chrono::steady_clock::time_point::max())
+						m_qMessagesIn.wait();
+					else
+						m_qMessagesIn.wait_until(tpWake);
 				}
 
-				bool bInvalidClientExists = false;
-				for (auto& client : m_deqConnections)
+				// 쌓인 메시지를 한 번에 꺼내 처리 (메시지마다 큐에 접근하지 않음)
+				m_qMessagesIn.drain_into(m_vIncoming, nMaxMessages);
+
+				for (auto& msg : m_vIncoming)
 				{
-					if (client && !client->IsConnected())
+					switch (msg.event)
 					{
-						OnClientDisconnect(client);
-						client.reset();
-
-						bInvalidClientExists = true;
+					case net_event::message:
+						OnMessage(msg.remote, msg.msg);
+						break;
+
+					case net_event::validated:
+						OnClientValidated(msg.remote);
+						break;
+
+					case net_event::disconnected:
+						OnClientDisconnect(msg.remote);
+						RemoveConnection(msg.remote);
+						break;
 					}
 				}
 
-				if (bInvalidClientExists)
-				{
-					m_deqConnections.erase(std::remove(m_deqConnections.begin(), m_deqConnections.end(), nullptr), m_deqConnections.end());
-				}
+				m_vIncoming.clear();
 
 				OnUpdate();
 			}
 
 		protected:
-			std::shared_ptr<connection<T>> GetConnectionByID(uint32_t id)
+			void AddConnection(std::shared_ptr<connection<T>> client)
 			{
-				for (auto& conn : m_deqConnections)
+				m_mapConnectionIndex[client->GetID()] = m_vConnections.size();
+				m_vConnections.push_back(std::move(client));
+			}
+
+			// 마지막 연결을 빈 자리로 옮겨 제거 (순서는 유지하지 않음)
+			void RemoveConnection(const std::shared_ptr<connection<T>>& client)
+			{
+				auto it = m_mapConnectionIndex.find(client->GetID());
+				if (it == m_mapConnectionIndex.end() || m_vConnections[it->second] != client)
+					return;
+
+				const size_t nIndex = it->second;
+				m_mapConnectionIndex.erase(it);
+
+				if (nIndex != m_vConnections.size() - 1)
 				{
-					if (conn->GetID() == id)
-						return conn;
+					m_vConnections[nIndex] = std::move(m_vConnections.back());
+					m_mapConnectionIndex[m_vConnections[nIndex]->GetID()] = nIndex;
 				}
-				return nullptr;
+				m_vConnections.pop_back();
+			}
+
+			std::shared_ptr<connection<T>> GetConnectionByID(uint32_t id)
+			{
+				auto it = m_mapConnectionIndex.find(id);
+				if (it == m_mapConnectionIndex.end())
+					return nullptr;
+
+				return m_vConnections[it->second];
 			}
 
 		protected:
@@ -173,9 +243,13 @@ namespace sp
 
 			}
 
-		protected:
+			// Update(.., true) 가 늦어도 이 시각에는 깨어나 OnUpdate 를 실행 (타이머가 없으면 max)
+			virtual std::chrono::steady_clock::time_point GetNextWakeTime()
+			{
+				return std::chrono::steady_clock::time_point::max();
+			}
 
-		public:
+			// 핸드셰이크를 통과한 연결 (메인 스레드, 이 연결의 첫 메시지보다 먼저 호출)
 			virtual void OnClientValidated(std::shared_ptr<connection<T>> client)
 			{
 
@@ -183,10 +257,17 @@ namespace sp
 
 		protected:
 			tsqueue<owned_message<T>> m_qMessagesIn;
-			std::deque<std::shared_ptr<connection<T>>> m_deqConnections;
+			std::vector<owned_message<T>> m_vIncoming;					// Update 에서 재사용
+
+			// 메인 스레드 전용 연결 목록: id → 인덱스 맵으로 O(1) 조회, 제거는 swap-remove
+			std::vector<std::shared_ptr<connection<T>>> m_vConnections;
+			std::unordered_map<uint32_t, size_t> m_mapConnectionIndex;
+
+			tsqueue<std::shared_ptr<connection<T>>> m_qNewConnections;	// accept 스레드 → 메인 스레드
 
 			asio::io_context m_asioContext;
-			std::thread m_threadContext;
+			std::vector<std::thread> m_vIoThreads;
+			size_t m_nIoThreads = 1;
 
 			asio::ip::tcp::acceptor m_asioAcceptor;
 
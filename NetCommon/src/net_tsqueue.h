@@ -1,11 +1,18 @@
 #pragma once
 
 #include "net_common.h"
+#include "net_mpsc_queue.h"
 
 namespace sp
 {
 	namespace net
 	{
+		// ------------------------------------------------------------
+		//  mpsc_queue 위의 기존 인터페이스 어댑터
+		//  push_back 은 어느 스레드에서나 호출 (락 없음)
+		//  나머지(pop / front / empty / wait ...)는 소비자 스레드 하나에서만 호출
+		//  소비자 쪽은 꺼내 온 항목을 deqQueue 에 두고 순서대로 돌려줌
+		// ------------------------------------------------------------
 		template <typename T>
 		class tsqueue
 		{
@@ -13,59 +20,59 @@ namespace sp
 			tsqueue() = default;
 			tsqueue(const tsqueue<T>&) = delete;
 			virtual ~tsqueue() { clear(); }
-		
+
 		public:
 			const T& front()
 			{
-				std::scoped_lock lock(muxQueue);
+				if (deqQueue.empty())
+					refill();
 				return deqQueue.front();
 			}
 
 			const T& back()
 			{
-				std::scoped_lock lock(muxQueue);
+				refill();
 				return deqQueue.back();
 			}
 
 			void push_back(const T& item)
 			{
-				std::scoped_lock lock(muxQueue);
-				deqQueue.emplace_back(std::move(item));
+				mpscQueue.push(item);
+			}
 
-				std::unique_lock<std::mutex> ul(muxBlocking);
-				cvBlocking.notify_one();
+			void push_back(T&& item)
+			{
+				mpscQueue.push(std::move(item));
 			}
 
+			// 소비자 스레드 전용
 			void push_front(const T& item)
 			{
-				std::scoped_lock lock(muxQueue);
-				deqQueue.emplace_front(std::move(item));
-
-				std::unique_lock<std::mutex> ul(muxBlocking);
-				cvBlocking.notify_one();
+				deqQueue.emplace_front(item);
 			}
 
 			bool empty()
 			{
-				std::scoped_lock lock(muxQueue);
-				return deqQueue.empty();
+				return deqQueue.empty() && mpscQueue.empty();
 			}
 
 			size_t count()
 			{
-				std::scoped_lock lock(muxQueue);
+				refill();
 				return deqQueue.size();
 			}
 
-			void clear() 
+			void clear()
 			{
-				std::scoped_lock lock(muxQueue);
+				refill();
 				deqQueue.clear();
 			}
 
 			T pop_front()
 			{
-				std::scoped_lock lock(muxQueue);
+				if (deqQueue.empty())
+					refill();
+
 				auto t = std::move(deqQueue.front());
 				deqQueue.pop_front();
 				return t;
@@ -73,27 +80,92 @@ namespace sp
 
 			T pop_back()
 			{
-				std::scoped_lock lock(muxQueue);
+				refill();
+
 				auto t = std::move(deqQueue.back());
 				deqQueue.pop_back();
 				return t;
 			}
 
-			void wait()
+			// 최대 nMax 개를 들어온 순서대로 out 뒤에 추가 (락 한 번 없이 일괄 이동)
+			size_t drain_into(std::vector<T>& out, size_t nMax = -1)
 			{
-				while (empty())
+				size_t nCount = 0;
+				while (nCount < nMax && !deqQueue.empty())
 				{
-					std::unique_lock<std::mutex> ul(muxBlocking);
-					cvBlocking.wait(ul);
+					out.push_back(std::move(deqQueue.front()));
+					deqQueue.pop_front();
+					++nCount;
 				}
+
+				if (nCount == nMax)
+					return nCount;
+
+				if (nMax == size_t(-1))
+					return nCount + mpscQueue.drain_into(out);
+
+				// 상한을 넘는 나머지는 다음 호출을 위해 보관
+				vSpill.clear();
+				mpscQueue.drain_into(vSpill);
+
+				for (auto& item : vSpill)
+				{
+					if (nCount < nMax)
+					{
+						out.push_back(std::move(item));
+						++nCount;
+					}
+					else
+					{
+						deqQueue.push_back(std::move(item));
+					}
+				}
+
+				vSpill.clear();
+				return nCount;
+			}
+
+			void wait()
+			{
+				if (!deqQueue.empty())
+					return;
+
+				mpscQueue.wait();
+			}
+
+			void wait_until(const std::chrono::steady_clock::time_point& tpDeadline)
+			{
+				if (!deqQueue.empty())
+					return;
+
+				mpscQueue.wait_until(tpDeadline);
+			}
+
+			// 어느 스레드에서나 호출: 항목 없이 wait 중인 소비자를 깨움
+			void notify()
+			{
+				mpscQueue.notify();
 			}
 
 		protected:
-			std::mutex muxQueue;
-			std::deque<T> deqQueue;
-			std::condition_variable cvBlocking;
-			std::mutex muxBlocking;
+			void refill()
+			{
+				vSpill.clear();
+				if (mpscQueue.drain_into(vSpill) == 0)
+					return;
+
+				for (auto& item : vSpill)
+					deqQueue.push_back(std::move(item));
+
+				vSpill.clear();
+			}
+
+		protected:
+			mpsc_queue<T> mpscQueue;
 
+			// 소비자 스레드 전용
+			std::deque<T> deqQueue;
+			std::vector<T> vSpill;
 		};
 	}
-}
\ No newline at end of file
+}
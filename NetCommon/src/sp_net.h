@@ -2,6 +2,7 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include "net_common.h"
+#include "net_mpsc_queue.h"
 #include "net_tsqueue.h"
 #include "net_message.h"
 #include "net_client.h"
@@ -1,4 +1,5 @@
 #include "BagRandom.h"
+#include <cassert>
 
 BagRandom::BagRandom(uint64_t seed)
 {
@@ -9,27 +10,31 @@ BagRandom::~BagRandom() = default;
 
 Tetris::TetrominoType BagRandom::Next()
 {
-	if (m_Queue.empty())
+	if (m_nSize == 0)
 		Refill();
 
-	auto t = m_Queue.front();
-	m_Queue.pop_front();
-	
+	auto t = m_Queue[m_nHead];
+	m_nHead = (m_nHead + 1) % QUEUE_CAPACITY;
+	--m_nSize;
+
 	return t;
 }
 
 const Tetris::TetrominoType BagRandom::Peek(size_t i)
 {
-	while (m_Queue.size() <= i)
+	assert(i < Tetris::MINO_TYPE_COUNT);
+
+	while (m_nSize <= i)
 		Refill();
 
-	return m_Queue[i];
+	return m_Queue[(m_nHead + i) % QUEUE_CAPACITY];
 }
 
 void BagRandom::Seed(uint64_t seed)
 {
 	m_Random.Reseed(seed);
-	m_Queue.clear();
+	m_nHead = 0;
+	m_nSize = 0;
 }
 
 const void BagRandom::Refill()
@@ -44,9 +49,18 @@ const void BagRandom::Refill()
 		Tetris::TetrominoType::Z
 	};
 
-	std::shuffle(bag.begin(), bag.end(), m_Random.Engine());
+	// std::shuffle 은 구현마다 알고리즘이 달라 MSVC / GCC 빌드 간 가방이 달라짐
+	// → mt19937_64 원시 출력 (표준 고정) 으로 직접 Fisher-Yates (서버 PlayerSim 과 같은 순서 보장)
+	// 경계가 7 이하라 나머지 연산의 편향은 2^-60 수준으로 무시
+	auto& engine = m_Random.Engine();
+	for (size_t i = bag.size() - 1; i > 0; --i)
+	{
+		const size_t j = static_cast<size_t>(engine() % (i + 1));
+		std::swap(bag[i], bag[j]);
+	}
+
 	for (auto t : bag)
-		m_Queue.push_back(t);
+		m_Queue[(m_nHead + m_nSize++) % QUEUE_CAPACITY] = t;
 }
 
 
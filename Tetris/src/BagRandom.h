@@ -1,36 +1,42 @@
 #pragma once
 
 #include <array>
-#include <deque>
 #include "./utils/Random.h"
 #include <algorithm>
 #include "./common/TetrisTypes.h"
 
-// 7 ̳븦 Ͽ 
+// 7개의 미노를 셔플하여 제공
+// 큐는 고정 크기 링 버퍼 → 복사에 할당이 없음 (GameEngine 스냅샷 / 롤백)
 class BagRandom
 {
 public:
+	// 한 가방 + 미리보기 최대 한 가방 (2의 거듭제곱이라 인덱스 나머지가 마스크)
+	static constexpr size_t QUEUE_CAPACITY = 16;
+	static_assert(QUEUE_CAPACITY >= Tetris::MINO_TYPE_COUNT * 2, "BagRandom queue capacity");
+
 	BagRandom() = default;
 	BagRandom(uint64_t seed);
 	~BagRandom();
 
-	//  Ÿ ϳ  ( ڵ )
+	// 다음 타입 하나 꺼내기 (없으면 자동 리필)
 	Tetris::TetrominoType Next();
 
-	// ̸
+	// 미리보기 (i < MINO_TYPE_COUNT)
 	const Tetris::TetrominoType Peek(size_t i = 0);
 
-	// ť 
-	const size_t Size() const { return m_Queue.size(); }
+	// 큐 길이
+	const size_t Size() const { return m_nSize; }
 
-	// õ 
+	// 시드 설정
 	void Seed(uint64_t seed);
 
 private:
-	// 7 ̳ ٽ ä ( )
+	// 7개의 미노 다시 채우기 (랜덤 적용)
 	const void Refill();
 
 private:
 	Random m_Random{};
-	mutable std::deque<Tetris::TetrominoType> m_Queue;
+	std::array<Tetris::TetrominoType, QUEUE_CAPACITY> m_Queue{};
+	size_t m_nHead{ 0 };
+	size_t m_nSize{ 0 };
 };
\ No newline at end of file
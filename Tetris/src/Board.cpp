@@ -1,17 +1,19 @@
 ﻿#include "Board.h"
 #include "./utils/Logger.h"
 #include <cassert>
-#include "Console.h"
+#include <cstring>
+#include <algorithm>
 #include <string>
 #include "common/PacketProtocol.h"
 #include "Tetromino.h"
+#include "TetrominoTable.h"
 
 Board::Board(int width, int height) noexcept
 	: m_Width{ width }
 	, m_Height{ height }
-	, m_Cells(static_cast<size_t>(width*height), 0)
+	, m_FullRowMask{ static_cast<uint16_t>((1u << width) - 1u) }
 {
-
+	assert(width <= MAX_WIDTH && height <= BOARD_HEIGHT && width * height <= CELL_CAPACITY && "Board size exceeds bitboard capacity");
 }
 
 Board::~Board() = default;
@@ -21,7 +23,7 @@ const int Board::Get(int x, int y) const
 	if (OOB(x, y))
 		return -1;
 
-	return m_Cells[static_cast<size_t>(y * m_Width + x)];
+	return m_Types[static_cast<size_t>(y * m_Width + x)];
 }
 
 void Board::Set(int x, int y, int val)
@@ -38,27 +40,46 @@ void Board::Set(int x, int y, int val)
 		return;
 	}
 
-	m_Cells[static_cast<size_t>(y * m_Width + x)] = val;
+	m_Types[static_cast<size_t>(y * m_Width + x)] = static_cast<uint8_t>(val);
+
+	const uint16_t bit = static_cast<uint16_t>(1u << x);
+	if (val != 0)
+	{
+		m_Rows[y] |= bit;
+		m_ColumnHeights[x] = std::max(m_ColumnHeights[x], m_Height - y);
+	}
+	else
+	{
+		m_Rows[y] &= static_cast<uint16_t>(~bit);
+
+		// 표면 블록이 지워졌을 때만 해당 열 재계산
+		if (m_ColumnHeights[x] == m_Height - y)
+			RecalcColumnHeight(x);
+	}
 }
 
 void Board::Clear()
 {
-	std::fill(m_Cells.begin(), m_Cells.end(), 0);
+	m_Rows.fill(0);
+	m_Types.fill(0);
+	m_ColumnHeights.fill(0);
 }
 
 const bool Board::IsCollide(const Tetromino& t, int dx, int dy, Tetris::Rotation rot) const
 {
-	auto blocks = GetBlocks(t.GetType(), rot);
-	const int x0 = t.GetX() + dx;
-	const int y0 = t.GetY() + dy;
-	for (auto block : blocks)
+	const sPieceInfo& info = TetrominoTable::Get(t.GetType(), rot);
+	const int left = t.GetX() + dx + info.minX;
+	const int top = t.GetY() + dy + info.minY;
+
+	// 바운딩 박스가 벽 or 바닥을 벗어남
+	if (left < 0 || left + info.width > m_Width || top < 0 || top + info.height > m_Height)
+		return true;
+
+	// 행 단위로 AND (이미 다른 블록 존재)
+	for (int r = 0; r < info.height; ++r)
 	{
-		const int x = x0 + block.x;
-		const int y = y0 + block.y;
-		if (OOB(x, y))
-			return true; // 벽 or 바닥
-		if (Get(x, y) != 0)
-			return true; // 이미 다른 블록 존재
+		if (m_Rows[top + r] & (info.rowMasks[r] << left))
+			return true;
 	}
 
 	return false;
@@ -69,54 +90,105 @@ const bool Board::IsCollide(const Tetromino& t, int dx, int dy) const
 	return IsCollide(t, dx, dy, t.GetRotation());
 }
 
+const int Board::DropDistance(const Tetromino& t) const
+{
+	const sPieceInfo& info = TetrominoTable::Get(t.GetType(), t.GetRotation());
+
+	// 각 블록이 자기 열의 표면 위에 있으면 열 높이만으로 바로 계산
+	int dist = m_Height;
+	for (auto block : info.blocks)
+	{
+		const int x = t.GetX() + block.x;
+		const int y = t.GetY() + block.y;
+		if (OOB(x, y))
+		{
+			dist = -1;
+			break;
+		}
+
+		const int surfaceY = m_Height - m_ColumnHeights[x]; // 가장 위 블록의 행 (빈 열이면 m_Height)
+		if (y >= surfaceY)
+		{
+			dist = -1; // 오버행 아래에 들어가 있음
+			break;
+		}
+
+		dist = std::min(dist, surfaceY - y - 1);
+	}
+
+	if (dist >= 0)
+		return dist;
+
+	// 오버행 아래 등 표면 높이로 알 수 없는 경우 한 칸씩 검사
+	dist = 0;
+	while (!IsCollide(t, 0, dist + 1))
+		++dist;
+
+	return dist;
+}
+
 void Board::Lock(const Tetromino& t)
 {
-	const int color = static_cast<int>(t.GetType());
-	auto blocks = t.GetBlocks();
+	const uint8_t type = static_cast<uint8_t>(t.GetType());
+	const auto& blocks = TetrominoTable::Get(t.GetType(), t.GetRotation()).blocks;
 
 	for (auto block : blocks) {
 		const int x = t.GetX() + block.x;
 		const int y = t.GetY() + block.y;
 
-		Set(x, y, color);
+		if (OOB(x, y))
+		{
+			TETRIS_LOG("Unvalid params x: " + std::to_string(x) + "y: " + std::to_string(y));
+			continue;
+		}
+
+		m_Rows[y] |= static_cast<uint16_t>(1u << x);
+		m_Types[static_cast<size_t>(y * m_Width + x)] = type;
+		m_ColumnHeights[x] = std::max(m_ColumnHeights[x], m_Height - y);
 	}
 }
 
 const int Board::ClearFullLines()
 {
-	int cleared = 0;
-	for (int y = m_Height - 1; y >= 0; --y)
+	sClearedLines cleared;
+	return ClearFullLines(cleared);
+}
+
+const int Board::ClearFullLines(sClearedLines& outCleared)
+{
+	const size_t rowBytes = static_cast<size_t>(m_Width) * sizeof(uint8_t);
+
+	outCleared.count = 0;
+
+	// 아래에서 위로 한 번만 훑으면서 살아남은 행을 write 위치로 복사
+	int write = m_Height - 1;
+	for (int read = m_Height - 1; read >= 0; --read)
 	{
-		bool full = true;
-		for (int x = 0; x < m_Width; ++x)
+		if (m_Rows[read] == m_FullRowMask)
 		{
-			if (Get(x, y) == 0)
-			{
-				full = false;
-				break;
-			}
+			outCleared.rows[outCleared.count++] = read;
+			continue;
 		}
 
-		if (full)
+		if (write != read)
 		{
-			++cleared;
-
-			// 위에서 한줄 씩 내리기
-			for (int yy = y; yy > 0; --yy)
-			{
-				for (int x = 0; x < m_Width; ++x)
-					Set(x, yy, Get(x, yy - 1));
-			}
-			
-			// 맨 위는 비우기
-			for (int x = 0; x < m_Width; ++x)
-				Set(x, 0, 0);
-
-			++y; // 같은 y를 다시 검사(내려온 줄 검사)
+			m_Rows[write] = m_Rows[read];
+			std::memcpy(&m_Types[static_cast<size_t>(write) * rowBytes], &m_Types[static_cast<size_t>(read) * rowBytes], rowBytes);
 		}
+		--write;
+	}
+
+	// 내려온 만큼 맨 위는 비우기
+	if (write >= 0)
+	{
+		std::fill(m_Rows.begin(), m_Rows.begin() + write + 1, static_cast<uint16_t>(0));
+		std::memset(&m_Types[0], 0, rowBytes * static_cast<size_t>(write + 1));
 	}
 
-	return cleared;
+	if (outCleared.count > 0)
+		RecalcColumnHeights();
+
+	return outCleared.count;
 }
 
 const int Board::GetCellColor(int x, int y) const
@@ -141,21 +213,88 @@ sBoardState Board::ToPacket() const
 {
 	sBoardState pkt;
 
-	if (pkt.cells.size() != m_Cells.size())
+	const size_t cellCount = static_cast<size_t>(m_Width * m_Height);
+	if (pkt.cells.size() != cellCount)
 	{
 		TETRIS_ERROR("ToPacket Failed!");
-		__debugbreak();
+		TETRIS_DEBUGBREAK();
 	}
 
-	for (int i = 0; i < m_Cells.size(); ++i)
-		pkt.cells[i] = m_Cells[i];
+	for (size_t i = 0; i < cellCount; ++i)
+		pkt.cells[i] = m_Types[i];
 
 	return pkt;
 }
 
+void Board::FromPacket(const sBoardState& pkt)
+{
+	const size_t cellCount = static_cast<size_t>(m_Width * m_Height);
+	if (pkt.cells.size() != cellCount)
+	{
+		TETRIS_ERROR("FromPacket Failed!");
+		TETRIS_DEBUGBREAK();
+		return;
+	}
+
+	m_Rows.fill(0);
+	for (int y = 0; y < m_Height; ++y)
+	{
+		for (int x = 0; x < m_Width; ++x)
+		{
+			const size_t i = static_cast<size_t>(y * m_Width + x);
+			int val = pkt.cells[i];
+			if (val < 0 || val > m_TypeSize)
+			{
+				TETRIS_LOG("Unvalid params type: " + std::to_string(val));
+				val = 0;
+			}
+
+			m_Types[i] = static_cast<uint8_t>(val);
+			if (val != 0)
+				m_Rows[y] |= static_cast<uint16_t>(1u << x);
+		}
+	}
+
+	RecalcColumnHeights();
+}
+
+void Board::RecalcColumnHeights()
+{
+	m_ColumnHeights.fill(0);
+
+	// 위에서부터 처음 채워진 칸이 해당 열의 표면
+	uint16_t seen = 0;
+	for (int y = 0; y < m_Height && seen != m_FullRowMask; ++y)
+	{
+		const uint16_t fresh = m_Rows[y] & static_cast<uint16_t>(~seen);
+		if (fresh == 0)
+			continue;
+
+		for (int x = 0; x < m_Width; ++x)
+		{
+			if (fresh & (1u << x))
+				m_ColumnHeights[x] = m_Height - y;
+		}
+		seen |= fresh;
+	}
+}
+
+void Board::RecalcColumnHeight(int x)
+{
+	const uint16_t bit = static_cast<uint16_t>(1u << x);
+
+	m_ColumnHeights[x] = 0;
+	for (int y = 0; y < m_Height; ++y)
+	{
+		if (m_Rows[y] & bit)
+		{
+			m_ColumnHeights[x] = m_Height - y;
+			break;
+		}
+	}
+}
+
 std::array<Vec2, ROTATION_COUNT> Board::GetBlocks(Tetris::TetrominoType type, Tetris::Rotation rot)
 {
-	Tetromino temp{ type };
-	temp.SetRotation(rot);
-	return temp.GetBlocks();
+	return TetrominoTable::Get(type, rot).blocks;
 }
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
 #include "./utils/Types.h"
 #include "./utils/Colors.h"
 #include "./common/TetrisTypes.h"
@@ -9,6 +11,13 @@ class Console;
 class Tetromino;
 struct sBoardState;
 
+// 한 번의 라인 클리어 결과
+struct sClearedLines
+{
+	int count{ 0 };
+	std::array<int, BOARD_HEIGHT> rows{}; // 제거된 행 인덱스 (제거 전 보드 기준, 아래 → 위 순서)
+};
+
 class Board
 {
 public:
@@ -20,37 +29,62 @@ public:
 
 	const bool OOB(int x, int y) const { return x < 0 || x >= m_Width || y < 0 || y >= m_Height; }
 
-	//   (0̸  ĭ)
+	// 셀 접근 (0이면 빈 칸)
 	const int Get(int x, int y) const;
 	void Set(int x, int y, int val);
 	void Clear();
-	const std::vector<int>& GetAll() const { return m_Cells; }
 
-	// ̳븦 (dx, dy, rot)ŭ ̵/ȸ   浹ϴ  ȯ
+	// 비트보드 접근 (y번째 행의 점유 마스크, x번째 비트 = x번째 칸)
+	const uint16_t GetRow(int y) const { return m_Rows[static_cast<size_t>(y)]; }
+	const uint16_t GetFullRowMask() const { return m_FullRowMask; }
+
+	// x번째 열의 표면 높이 (0이면 빈 열, 바닥 기준 칸 수)
+	const int GetColumnHeight(int x) const { return m_ColumnHeights[static_cast<size_t>(x)]; }
+
+	// 미노를 (dx, dy, rot)만큼 이동/회전 했을 때 충돌하는지 여부 반환
 	const bool IsCollide(const Tetromino& t, int dx, int dy, Tetris::Rotation rot) const;
 	const bool IsCollide(const Tetromino& t, int dx, int dy) const;
+
+	// 미노가 현재 위치에서 떨어질 수 있는 칸 수 (고스트/하드드롭용)
+	const int DropDistance(const Tetromino& t) const;
 	
-	// ̳븦 忡 
+	// 미노를 보드에 고정
 	void Lock(const Tetromino& t);
 
-	//       .    ȯ.
+	// 가득 찬 라인 제거 및 위에서 당기기. 제거한 라인 수 반환.
 	const int ClearFullLines();
+	const int ClearFullLines(sClearedLines& outCleared);
 
-	// (x,y) ĭ  ȯ
+	// (x,y) 칸의 색상 반환
 	const int GetCellColor(int x, int y) const;
 
-	// ֿܼ  ׸
+	// 콘솔에 보드 그리기
 	void Draw(Console& console, int left, int top);
 
-	// ȭ export Լ
+	// 직렬화용 export/import 함수
 	sBoardState ToPacket() const;
+	void FromPacket(const sBoardState& pkt);
 
 public:
-	//    ̳븦 ׸    ǥ(ȸ ݿ)
+	// 현재 보드 위에 미노를 그릴 때 사용할 블록 좌표(회전 반영)
 	static std::array<Vec2, ROTATION_COUNT> GetBlocks(Tetris::TetrominoType type, Tetris::Rotation rot);
 
+private:
+	// 행 마스크로부터 열 높이 전체 재계산
+	void RecalcColumnHeights();
+	void RecalcColumnHeight(int x);
+
+public:
+	// 행 마스크가 uint16_t 이므로 보드 너비는 최대 16칸
+	static constexpr int MAX_WIDTH = 16;
+	static constexpr int CELL_CAPACITY = BOARD_WIDTH * BOARD_HEIGHT;
+
 private:
 	int m_Width{ BOARD_WIDTH }, m_Height{ BOARD_HEIGHT };
 	int m_TypeSize{ MINO_TYPE_COUNT };
-	std::vector<int> m_Cells; // 0: ִ , [1..TetrominoType::Z]:  Ÿ
+	uint16_t m_FullRowMask{ 0 };
+
+	std::array<uint16_t, BOARD_HEIGHT> m_Rows{};	// 행별 점유 비트마스크 (충돌/라인 검사용)
+	std::array<uint8_t, CELL_CAPACITY> m_Types{};	// 0: 비어있는 상태, [1..TetrominoType::Z]: 블럭 타입 (색상용)
+	std::array<int, MAX_WIDTH> m_ColumnHeights{};	// 열별 표면 높이 (Lock/ClearFullLines/Set 시 갱신)
 };
\ No newline at end of file
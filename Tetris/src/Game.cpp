@@ -63,20 +63,20 @@ bool Game::Init()
 		return false;
 	}
 
-	// ʱ  
+	// 초기 사운드 조절
 	{
 		m_pSoundManager->SetMasterVolume(0.8f);
 		m_pSoundManager->SetBGMVolume(0.5f);
 		m_pSoundManager->SetSEVolume(1.0f);
 	}
 
-	// BGM ε
+	// BGM 로드
 	{
 		m_pSoundManager->LoadBGM("title_bgm", "assets/audio/title_bgm.wav", true);
 		m_pSoundManager->LoadBGM("play_bgm", "assets/audio/play_bgm.mp3", true);
 	}
 
-	// ΰ  ε
+	// 인게임 사운드 로드
 	{
 		m_pSoundManager->LoadSE("move", "assets/audio/Tetrio_retro_pack/move.wav");
 		m_pSoundManager->LoadSE("hold", "assets/audio/Tetrio_retro_pack/hold.wav");
@@ -85,7 +85,7 @@ bool Game::Init()
 		m_pSoundManager->LoadSE("floor", "assets/audio/Tetrio_retro_pack/floor.wav");
 		m_pSoundManager->LoadSE("failure", "assets/audio/Tetrio_retro_pack/failure.wav");
 
-		// ޺ 
+		// 콤보 사운드
 		for (int i = 1; i <= 16; ++i)
 		{
 			std::string combo_string = "combo_" + std::to_string(i);
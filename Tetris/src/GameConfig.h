@@ -1,4 +1,9 @@
+#pragma once
+
 namespace GameConfig
 {
 	constexpr int SoftDropIntervalMS = 30;
+
+	constexpr int BotThinkBudgetMS = 30;
+	constexpr int BotInputIntervalMS = 90;
 }
\ No newline at end of file
@@ -21,7 +21,7 @@ void Score::OnLinesCleared(int cleared, bool isTSpin)
 		return;
 	}
 
-	//  Ŭ 
+	// 라인 클리어 존재
 
 	++m_Combo;
 	AddLineScore(cleared, isTSpin);
@@ -65,7 +65,7 @@ void Score::HandleBackToBack(bool isTSpin, bool isTetris)
 	{
 		if (m_bBackToBack)
 		{
-			//  ʽ
+			// 백투백 보너스
 			m_Score += 100 * m_Level;
 		}
 		m_bBackToBack = true;
@@ -8,10 +8,10 @@ public:
 
 	void Reset();
 
-	//  Ͽ  Ŭ  
+	// 한 턴에서 라인 클리어 결과 전달
 	void OnLinesCleared(int cleared, bool isTSpin = false);
 
-	// Ʈ/ϵ  
+	// 소프트/하드 드롭 계산
 	void AddSoftDrop(int cells);
 	void AddHardDrop(int cells);
 
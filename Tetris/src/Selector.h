@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <algorithm>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <type_traits>
@@ -4,6 +4,7 @@
 #include "./utils/Colors.h"
 #include "./common/TetrisTypes.h"
 #include <array>
+#include <cstddef>
 
 class Tetromino
 {
@@ -24,23 +25,24 @@ public:
 	void RotateCW();
 	void RotateCCW();
 
-	//  ȸ  4  ǥ ȯ
+	// 현재 회전 상태의 4블록 상대 좌표 반환
 	const std::array<Vec2, Tetris::MINO_COUNT> GetBlocks() const;
 
 	const int GetColor() const;
 
 	// static int ColorFromType(TetrominoType type);
 
-	// ̸ 뵵  ǥ ȯ
+	// 미리보기 용도 상대 좌표 반환
 	static std::array<Vec2, Tetris::MINO_COUNT> BlocksFromType(Tetris::TetrominoType type);
 
 private:
-	// ð/ݽð ȸ (  浹 δ 尡 Ǵ)
+	// 시계/반시계 회전 (실제 격자 충돌 여부는 보드가 판단)
 	// static constexpr Rotation nextCW(Rotation r);
 	// static constexpr Rotation nextCCW(Rotation r);
 
-private:
-	//  ̳ 4  ǥ ( ȸ 4 )
+public:
+	// 각 미노의 4개 블록 상대좌표 (각 회전마다 4개 블록)
+	// TetrominoTable 이 컴파일 타임에 행 마스크/바운딩 박스를 생성할 때도 사용
 	static constexpr std::array<std::array<std::array<Vec2, Tetris::MINO_COUNT>, Tetris::ROTATION_COUNT>, Tetris::MINO_TYPE_COUNT> Shapes{{
 		/* I */
 		{{
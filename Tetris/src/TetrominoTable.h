@@ -0,0 +1,88 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include "./utils/Types.h"
+#include "./common/TetrisTypes.h"
+#include "Tetromino.h"
+
+// --------------------------------------------------------------------
+//  (TetrominoType, Rotation) 별 미노 정보
+//  Tetromino::Shapes 로부터 컴파일 타임에 생성되며, 충돌/고스트/렌더링 등
+//  hot loop 에서 Tetromino 임시 객체 생성 없이 조회만 하도록 사용
+// --------------------------------------------------------------------
+struct sPieceInfo
+{
+	std::array<Vec2, Tetris::MINO_COUNT> blocks{};
+
+	// 바운딩 박스 (피벗 기준 상대 좌표, 양 끝 포함)
+	int minX{}, maxX{}, minY{}, maxY{};
+	int width{}, height{};
+
+	// 바운딩 박스 기준 행 마스크 (rowMasks[r]: minY + r 행, bit i: minX + i 열)
+	std::array<uint16_t, Tetris::MINO_COUNT> rowMasks{};
+
+	// 스폰 위치 (피벗 좌표) 및 스폰 시 바운딩 박스 좌상단 위치
+	Vec2 spawn{};
+	Vec2 spawnOffset{};
+};
+
+namespace TetrominoTable
+{
+	using TableType = std::array<std::array<sPieceInfo, Tetris::ROTATION_COUNT>, Tetris::MINO_TYPE_COUNT>;
+
+	// 현재 스폰 규칙: 중앙 상단 (BOARD_WIDTH/2, 1)
+	constexpr Vec2 SPAWN_POS{ BOARD_WIDTH / 2, 1 };
+
+	constexpr sPieceInfo Build(const std::array<Vec2, Tetris::MINO_COUNT>& blocks)
+	{
+		sPieceInfo info{};
+		info.blocks = blocks;
+
+		info.minX = info.maxX = blocks[0].x;
+		info.minY = info.maxY = blocks[0].y;
+		for (const auto& b : blocks)
+		{
+			info.minX = b.x < info.minX ? b.x : info.minX;
+			info.maxX = b.x > info.maxX ? b.x : info.maxX;
+			info.minY = b.y < info.minY ? b.y : info.minY;
+			info.maxY = b.y > info.maxY ? b.y : info.maxY;
+		}
+		info.width = info.maxX - info.minX + 1;
+		info.height = info.maxY - info.minY + 1;
+
+		for (const auto& b : blocks)
+			info.rowMasks[static_cast<size_t>(b.y - info.minY)] |= static_cast<uint16_t>(1u << (b.x - info.minX));
+
+		info.spawn = SPAWN_POS;
+		info.spawnOffset = { SPAWN_POS.x + info.minX, SPAWN_POS.y + info.minY };
+
+		return info;
+	}
+
+	constexpr TableType BuildTable()
+	{
+		TableType table{};
+		for (size_t t = 0; t < Tetris::MINO_TYPE_COUNT; ++t)
+			for (size_t r = 0; r < Tetris::ROTATION_COUNT; ++r)
+				table[t][r] = Build(Tetromino::Shapes[t][r]);
+
+		return table;
+	}
+
+	inline constexpr TableType Table = BuildTable();
+
+	constexpr const sPieceInfo& Get(Tetris::TetrominoType type, Tetris::Rotation rot)
+	{
+		// [0...7)
+		assert(type != Tetris::TetrominoType::None && "Invalid TetrominoType");
+		return Table[static_cast<size_t>(type) - 1][static_cast<size_t>(rot)];
+	}
+}
+
+// 모든 미노는 4x4 안에 들어가야 행 마스크(최대 4행)로 표현 가능
+static_assert(TetrominoTable::Get(Tetris::TetrominoType::I, Tetris::Rotation::R0).rowMasks[0] == 0b1111, "I piece row mask mismatch");
+static_assert(TetrominoTable::Get(Tetris::TetrominoType::I, Tetris::Rotation::R90).height == 4, "I piece bounding box mismatch");
+static_assert(TetrominoTable::Get(Tetris::TetrominoType::T, Tetris::Rotation::R0).rowMasks[1] == 0b111, "T piece row mask mismatch");
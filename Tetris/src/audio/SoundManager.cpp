@@ -9,7 +9,7 @@ SoundManager::~SoundManager()
 
 bool SoundManager::Init()
 {
-	if (m_System) // ̹ ʱȭ Ǿִ 
+	if (m_System) // 이미 초기화 되어있는 경우
 		return true;
 
 	FMOD::System* rawSystem = nullptr;
@@ -17,13 +17,13 @@ bool SoundManager::Init()
 	if (result != FMOD_OK || !rawSystem)
 		return false;
 
-	//  
+	// 소유권 이전
 	m_System.reset(rawSystem);
 
 	result = m_System->init(512, FMOD_INIT_NORMAL, nullptr);
 	if (result != FMOD_OK)
 	{
-		// init   ý 
+		// init 실패 시 시스템 해제
 		m_System.reset();
 		return false;
 	}
@@ -44,12 +44,12 @@ void SoundManager::Shutdown()
 		m_BGMChannel = nullptr;
 	}
 
-	// ʿ ִ  unique_ptr ˾Ƽ release() ȣ
+	// 맵에 들어있는 사운드들은 unique_ptr로 알아서 release() 호출됨
 	m_BGMs.clear();
 	m_SEs.clear();
 	m_SEChannels.clear();
 
-	// Ŀ deleter ȣ
+	// 커스텀 deleter 호출
 	if (m_System)
 		m_System.reset();
 }
@@ -99,10 +99,10 @@ void SoundManager::PlayBGM(const std::string& name)
 		return;
 
 	auto it = m_BGMs.find(name);
-	if (it == m_BGMs.end() || !it->second)  // sound ų null 
+	if (it == m_BGMs.end() || !it->second)  // sound가 없거나 null인 경우
 		return;
 
-	//  BGM 
+	// 기존 BGM 정지
 	if (m_BGMChannel) 
 	{
 		bool playing = false;
@@ -174,7 +174,7 @@ void SoundManager::PlaySE_Force(const std::string& name)
 	auto& channel = m_SEChannels[name];
 	if (channel)
 	{
-		// ̹ ̶ ߴ
+		// 이미 재생중이라면 중단
 		bool isPlaying = false;
 		if (channel->isPlaying(&isPlaying) == FMOD_OK && isPlaying)
 		{
@@ -199,7 +199,7 @@ void SoundManager::SetMasterVolume(float volume)
 {
 	m_MasterVolume = std::clamp(volume, 0.0f, 1.0f);
 
-	//    BGM  ݿ
+	// 현재 재생 중인 BGM에 즉시 반영
 	if (m_BGMChannel) 
 	{
 		const float vol = m_MasterVolume * m_BGMVolume;
@@ -39,23 +39,23 @@ public:
 	SoundManager() = default;
 	~SoundManager();
 
-	// FMOD ý ʱȭ / 
+	// FMOD 시스템 초기화 / 해제
 	bool Init();
 	void Shutdown();
 
 	void Update();
 	
-	// ε
+	// 로드
 	bool LoadBGM(const std::string& name, const std::string& filepath, bool loop = true);
 	bool LoadSE(const std::string& name, const std::string& filepath);
 	
-	// 
+	// 재생
 	void PlayBGM(const std::string& name);
 	void StopBGM();
 	void PlaySE(const std::string& name);
 	void PlaySE_Force(const std::string& name);
 
-	// 
+	// 볼륨
 	void SetMasterVolume(float volume); // [0.0 .. 1.0]
 	void SetBGMVolume(float volume);    // [0.0 .. 1.0]
 	void SetSEVolume(float volume);     // [0.0 .. 1.0]
@@ -67,13 +67,13 @@ public:
 private:
 	FmodSystemPtr m_System;
 
-	// ̸ -> 
+	// 이름 -> 사운드
 	std::unordered_map<std::string, FmodSoundPtr> m_BGMs;
 	std::unordered_map<std::string, FmodSoundPtr> m_SEs;
 
 	std::unordered_map<std::string, FMOD::Channel*> m_SEChannels;
 
-	//    BGM ä
+	// 현재 재생 중인 BGM 채널
 	FMOD::Channel* m_BGMChannel{ nullptr };
 
 	float m_MasterVolume{ 1.0f };
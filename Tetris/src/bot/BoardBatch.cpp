@@ -0,0 +1,224 @@
+﻿#include "BoardBatch.h"
+#include "../Board.h"
+#include "../TetrominoTable.h"
+#include "../engine/MoveGenerator.h"
+#include <algorithm>
+#include <cstdlib>
+
+#if TETRIS_BATCH_X86 && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+using namespace Tetris;
+
+void BoardBatch::Reset(const Board& base)
+{
+	m_Width = base.GetWidth();
+	m_FullRowMask = base.GetFullRowMask();
+
+	for (int y = 0; y < BOARD_HEIGHT; ++y)
+		m_BaseRows[static_cast<size_t>(y)] = base.GetRow(y);
+
+	m_Count = 0;
+	m_LinesCleared.fill(0);
+
+	for (auto& lanes : m_Rows)
+		lanes.fill(0);
+}
+
+int BoardBatch::Push(const sPlacement& placement)
+{
+	if (IsFull())
+		return -1;
+
+	std::array<uint16_t, BOARD_HEIGHT> rows = m_BaseRows;
+
+	// 고정 (Board::Lock 의 행 마스크 부분과 동일)
+	const sPieceInfo& info = TetrominoTable::Get(placement.type, placement.rot);
+	const int left = placement.x + info.minX;
+	const int top = placement.y + info.minY;
+	for (int r = 0; r < info.height; ++r)
+		rows[static_cast<size_t>(top + r)] |= static_cast<uint16_t>(info.rowMasks[static_cast<size_t>(r)] << left);
+
+	// 아래에서 위로 한 번 훑으며 가득 찬 행을 건너뛰고 압축
+	const int lane = m_Count++;
+	int write = BOARD_HEIGHT - 1;
+	for (int read = BOARD_HEIGHT - 1; read >= 0; --read)
+	{
+		const uint16_t row = rows[static_cast<size_t>(read)];
+		if (row == m_FullRowMask)
+			continue;
+
+		m_Rows[static_cast<size_t>(write--)][static_cast<size_t>(lane)] = row;
+	}
+
+	m_LinesCleared[static_cast<size_t>(lane)] = write + 1;
+	for (; write >= 0; --write)
+		m_Rows[static_cast<size_t>(write)][static_cast<size_t>(lane)] = 0;
+
+	return lane;
+}
+
+sBoardFeatures sBatchFeatures::Get(int lane) const
+{
+	const size_t i = static_cast<size_t>(lane);
+
+	sBoardFeatures f;
+	f.aggregateHeight = aggregateHeight[i];
+	f.maxHeight = maxHeight[i];
+	f.holes = holes[i];
+	f.bumpiness = bumpiness[i];
+	f.wells = wells[i];
+	f.rowTransitions = rowTransitions[i];
+	return f;
+}
+
+namespace
+{
+	bool CpuHasAVX2()
+	{
+#if TETRIS_BATCH_X86 && defined(_MSC_VER)
+		int info[4]{};
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		// OS 가 YMM 레지스터를 저장/복원하는지 (OSXSAVE + XCR0) 까지 확인
+		__cpuid(info, 1);
+		const bool bOsxsave = (info[2] & (1 << 27)) != 0;
+		const bool bAvx = (info[2] & (1 << 28)) != 0;
+		if (!bOsxsave || !bAvx || (_xgetbv(0) & 0x6) != 0x6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#elif TETRIS_BATCH_X86
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#else
+		return false;
+#endif
+	}
+}
+
+BatchKernel BoardBatchKernel::GetBest()
+{
+	static const BatchKernel s_Best = []()
+	{
+#if TETRIS_BATCH_X86
+		// x64 는 SSE2 가 기본
+		return CpuHasAVX2() ? BatchKernel::AVX2 : BatchKernel::SSE2;
+#else
+		return BatchKernel::Scalar;
+#endif
+	}();
+
+	return s_Best;
+}
+
+bool BoardBatchKernel::IsSupported(BatchKernel kernel)
+{
+	switch (kernel)
+	{
+	case BatchKernel::Scalar:
+		return true;
+	case BatchKernel::SSE2:
+		return TETRIS_BATCH_X86 != 0;
+	case BatchKernel::AVX2:
+		return GetBest() == BatchKernel::AVX2;
+	}
+
+	return false;
+}
+
+const char* BoardBatchKernel::GetName(BatchKernel kernel)
+{
+	switch (kernel)
+	{
+	case BatchKernel::Scalar:
+		return "scalar";
+	case BatchKernel::SSE2:
+		return "sse2";
+	case BatchKernel::AVX2:
+		return "avx2";
+	}
+
+	return "unknown";
+}
+
+void BoardBatchKernel::Evaluate(const BoardBatch& batch, sBatchFeatures& out)
+{
+	Evaluate(batch, out, GetBest());
+}
+
+void BoardBatchKernel::Evaluate(const BoardBatch& batch, sBatchFeatures& out, BatchKernel kernel)
+{
+	switch (kernel)
+	{
+#if TETRIS_BATCH_X86
+	case BatchKernel::AVX2:
+		EvaluateAVX2(batch, out);
+		return;
+	case BatchKernel::SSE2:
+		EvaluateSSE2(batch, out);
+		return;
+#endif
+	default:
+		EvaluateScalar(batch, out);
+		return;
+	}
+}
+
+void BoardBatchKernel::EvaluateScalar(const BoardBatch& batch, sBatchFeatures& out)
+{
+	const int width = batch.GetWidth();
+	const uint32_t wallMask = (1u << (width + 1)) - 1;
+
+	for (int lane = 0; lane < BoardBatch::LANES; ++lane)
+	{
+		std::array<int, Board::MAX_WIDTH> heights{};
+		uint16_t covered = 0;
+		int filled = 0;
+		int transitions = 0;
+
+		// 위에서부터: 블록이 한 번이라도 나온 열은 그 아래 모든 행에서 높이 +1
+		for (int y = 0; y < BOARD_HEIGHT; ++y)
+		{
+			const uint16_t row = batch.GetRowLanes(y)[lane];
+			covered |= row;
+
+			for (int x = 0; x < width; ++x)
+				heights[static_cast<size_t>(x)] += (covered >> x) & 1;
+
+			const uint32_t walled = (static_cast<uint32_t>(row) << 1) | 1u | (1u << (width + 1));
+			for (uint32_t t = (walled ^ (walled >> 1)) & wallMask; t; t &= t - 1)
+				++transitions;
+
+			for (uint32_t r = row; r; r &= r - 1)
+				++filled;
+		}
+
+		int aggregate = 0, maxHeight = 0, bumpiness = 0, wells = 0;
+		for (int x = 0; x < width; ++x)
+		{
+			const int h = heights[static_cast<size_t>(x)];
+			const int left = (x > 0) ? heights[static_cast<size_t>(x - 1)] : BOARD_HEIGHT;
+			const int right = (x + 1 < width) ? heights[static_cast<size_t>(x + 1)] : BOARD_HEIGHT;
+
+			aggregate += h;
+			maxHeight = std::max(maxHeight, h);
+			wells += std::max(0, std::min(left, right) - h);
+			if (x + 1 < width)
+				bumpiness += std::abs(h - right);
+		}
+
+		const size_t i = static_cast<size_t>(lane);
+		out.aggregateHeight[i] = static_cast<int16_t>(aggregate);
+		out.maxHeight[i] = static_cast<int16_t>(maxHeight);
+		out.holes[i] = static_cast<int16_t>(aggregate - filled);	// 표면 아래 칸 중 비어 있는 칸
+		out.bumpiness[i] = static_cast<int16_t>(bumpiness);
+		out.wells[i] = static_cast<int16_t>(wells);
+		out.rowTransitions[i] = static_cast<int16_t>(transitions);
+	}
+}
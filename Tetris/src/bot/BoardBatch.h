@@ -0,0 +1,97 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "BoardEvaluator.h"
+#include "../utils/Types.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define TETRIS_BATCH_X86 1
+#else
+#define TETRIS_BATCH_X86 0
+#endif
+
+class Board;
+struct sPlacement;
+
+// --------------------------------------------------------------------
+//  후보 배치 결과 보드 LANES 개를 SoA 로 나란히 보관
+//
+//  rows[y][lane] = lane 번째 후보 보드의 y 행 비트마스크
+//  → 한 행의 16 후보가 32 바이트로 연속되어 AVX2 한 번 / SSE2 두 번에 로드됨
+//  Board 복사 (셀 타입 배열 포함) 없이 행 마스크만 다룸
+// --------------------------------------------------------------------
+class BoardBatch
+{
+public:
+	static constexpr int LANES = 16;
+
+	// 행 전이 계산 시 양쪽 벽 비트까지 16비트 레인 안에 들어가야 함
+	static_assert(BOARD_WIDTH + 2 <= 16, "BoardBatch kernels use 16-bit lanes");
+
+	// 기준 보드 지정 후 비움
+	void Reset(const Board& base);
+
+	// 기준 보드 + placement 고정 + 라인 클리어 결과를 다음 레인에 추가. 레인 인덱스 반환 (가득 차면 -1)
+	int Push(const sPlacement& placement);
+
+	const int GetCount() const { return m_Count; }
+	const bool IsFull() const { return m_Count >= LANES; }
+	const int GetWidth() const { return m_Width; }
+	const int GetLinesCleared(int lane) const { return m_LinesCleared[static_cast<size_t>(lane)]; }
+
+	const uint16_t* GetRowLanes(int y) const { return m_Rows[static_cast<size_t>(y)].data(); }
+
+private:
+	int m_Width{ BOARD_WIDTH };
+	uint16_t m_FullRowMask{ 0 };
+	std::array<uint16_t, BOARD_HEIGHT> m_BaseRows{};
+
+	int m_Count{ 0 };
+	std::array<int, LANES> m_LinesCleared{};
+
+	alignas(32) std::array<std::array<uint16_t, LANES>, BOARD_HEIGHT> m_Rows{};
+};
+
+// 레인별 특징값 (SoA, 커널 출력)
+struct sBatchFeatures
+{
+	alignas(32) std::array<int16_t, BoardBatch::LANES> aggregateHeight{};
+	alignas(32) std::array<int16_t, BoardBatch::LANES> maxHeight{};
+	alignas(32) std::array<int16_t, BoardBatch::LANES> holes{};
+	alignas(32) std::array<int16_t, BoardBatch::LANES> bumpiness{};
+	alignas(32) std::array<int16_t, BoardBatch::LANES> wells{};
+	alignas(32) std::array<int16_t, BoardBatch::LANES> rowTransitions{};
+
+	sBoardFeatures Get(int lane) const;
+};
+
+enum class BatchKernel : uint8_t
+{
+	Scalar,
+	SSE2,
+	AVX2,
+};
+
+// --------------------------------------------------------------------
+//  열 높이 / 구멍 / 울퉁불퉁함 / 우물 / 행 전이를 모든 레인에 대해 한 번에 계산
+//  결과는 레인마다 BoardEvaluator::Extract 와 동일
+// --------------------------------------------------------------------
+namespace BoardBatchKernel
+{
+	// 실행 중인 CPU 에서 사용할 수 있는 가장 빠른 커널 (최초 호출 시 한 번 판별)
+	BatchKernel GetBest();
+	bool IsSupported(BatchKernel kernel);
+	const char* GetName(BatchKernel kernel);
+
+	void Evaluate(const BoardBatch& batch, sBatchFeatures& out);
+	void Evaluate(const BoardBatch& batch, sBatchFeatures& out, BatchKernel kernel);
+
+	// 커널 구현 (SSE2 / AVX2 는 BoardBatchSimd.cpp, TETRIS_BATCH_X86 일 때만 정의)
+	void EvaluateScalar(const BoardBatch& batch, sBatchFeatures& out);
+#if TETRIS_BATCH_X86
+	void EvaluateSSE2(const BoardBatch& batch, sBatchFeatures& out);
+	void EvaluateAVX2(const BoardBatch& batch, sBatchFeatures& out);
+#endif
+}
@@ -0,0 +1,163 @@
+﻿#include "BoardBatch.h"
+#include "../Board.h"
+
+#if TETRIS_BATCH_X86
+
+#include <immintrin.h>
+
+// MSVC 는 /arch 없이도 AVX2 intrinsic 을 허용하지만 GCC/Clang 은 함수 단위 target 지정 필요
+#if defined(__GNUC__) || defined(__clang__)
+#define TETRIS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TETRIS_TARGET_AVX2
+#endif
+
+namespace
+{
+	// 16비트 레인별 popcount (SSSE3 pshufb 없이 SWAR)
+	inline __m128i PopCount16(__m128i v)
+	{
+		v = _mm_sub_epi16(v, _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi16(0x5555)));
+		v = _mm_add_epi16(_mm_and_si128(v, _mm_set1_epi16(0x3333)), _mm_and_si128(_mm_srli_epi16(v, 2), _mm_set1_epi16(0x3333)));
+		v = _mm_and_si128(_mm_add_epi16(v, _mm_srli_epi16(v, 4)), _mm_set1_epi16(0x0f0f));
+		return _mm_and_si128(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), _mm_set1_epi16(0x001f));
+	}
+
+	TETRIS_TARGET_AVX2 inline __m256i PopCount16(__m256i v)
+	{
+		v = _mm256_sub_epi16(v, _mm256_and_si256(_mm256_srli_epi16(v, 1), _mm256_set1_epi16(0x5555)));
+		v = _mm256_add_epi16(_mm256_and_si256(v, _mm256_set1_epi16(0x3333)), _mm256_and_si256(_mm256_srli_epi16(v, 2), _mm256_set1_epi16(0x3333)));
+		v = _mm256_and_si256(_mm256_add_epi16(v, _mm256_srli_epi16(v, 4)), _mm256_set1_epi16(0x0f0f));
+		return _mm256_and_si256(_mm256_add_epi16(v, _mm256_srli_epi16(v, 8)), _mm256_set1_epi16(0x001f));
+	}
+
+	// 레인 [offset, offset + 8) 처리
+	void EvaluateHalfSSE2(const BoardBatch& batch, int offset, sBatchFeatures& out)
+	{
+		const int width = batch.GetWidth();
+
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i one = _mm_set1_epi16(1);
+		const __m128i walls = _mm_set1_epi16(static_cast<short>(1 | (1 << (width + 1))));
+		const __m128i wallMask = _mm_set1_epi16(static_cast<short>((1 << (width + 1)) - 1));
+
+		__m128i heights[Board::MAX_WIDTH];
+		for (int x = 0; x < width; ++x)
+			heights[x] = zero;
+
+		__m128i covered = zero;
+		__m128i filled = zero;
+		__m128i transitions = zero;
+
+		for (int y = 0; y < BOARD_HEIGHT; ++y)
+		{
+			const __m128i row = _mm_load_si128(reinterpret_cast<const __m128i*>(batch.GetRowLanes(y) + offset));
+			covered = _mm_or_si128(covered, row);
+
+			// 열 x 에 블록이 이미 나왔으면 높이 +1 (시프트 수가 상수가 되도록 한 칸씩 밀어가며)
+			__m128i bits = covered;
+			for (int x = 0; x < width; ++x)
+			{
+				heights[x] = _mm_add_epi16(heights[x], _mm_and_si128(bits, one));
+				bits = _mm_srli_epi16(bits, 1);
+			}
+
+			const __m128i walled = _mm_or_si128(_mm_slli_epi16(row, 1), walls);
+			transitions = _mm_add_epi16(transitions, PopCount16(_mm_and_si128(_mm_xor_si128(walled, _mm_srli_epi16(walled, 1)), wallMask)));
+			filled = _mm_add_epi16(filled, PopCount16(row));
+		}
+
+		const __m128i wallHeight = _mm_set1_epi16(BOARD_HEIGHT);
+		__m128i aggregate = zero, maxHeight = zero, bumpiness = zero, wells = zero;
+
+		for (int x = 0; x < width; ++x)
+		{
+			const __m128i h = heights[x];
+			const __m128i left = (x > 0) ? heights[x - 1] : wallHeight;
+			const __m128i right = (x + 1 < width) ? heights[x + 1] : wallHeight;
+
+			aggregate = _mm_add_epi16(aggregate, h);
+			maxHeight = _mm_max_epi16(maxHeight, h);
+			wells = _mm_add_epi16(wells, _mm_max_epi16(_mm_sub_epi16(_mm_min_epi16(left, right), h), zero));
+			if (x + 1 < width)
+				bumpiness = _mm_add_epi16(bumpiness, _mm_sub_epi16(_mm_max_epi16(h, right), _mm_min_epi16(h, right)));
+		}
+
+		_mm_store_si128(reinterpret_cast<__m128i*>(out.aggregateHeight.data() + offset), aggregate);
+		_mm_store_si128(reinterpret_cast<__m128i*>(out.maxHeight.data() + offset), maxHeight);
+		_mm_store_si128(reinterpret_cast<__m128i*>(out.holes.data() + offset), _mm_sub_epi16(aggregate, filled));
+		_mm_store_si128(reinterpret_cast<__m128i*>(out.bumpiness.data() + offset), bumpiness);
+		_mm_store_si128(reinterpret_cast<__m128i*>(out.wells.data() + offset), wells);
+		_mm_store_si128(reinterpret_cast<__m128i*>(out.rowTransitions.data() + offset), transitions);
+	}
+}
+
+void BoardBatchKernel::EvaluateSSE2(const BoardBatch& batch, sBatchFeatures& out)
+{
+	static_assert(BoardBatch::LANES == 16, "SSE2 kernel processes two 8-lane halves");
+
+	EvaluateHalfSSE2(batch, 0, out);
+	EvaluateHalfSSE2(batch, 8, out);
+}
+
+TETRIS_TARGET_AVX2 void BoardBatchKernel::EvaluateAVX2(const BoardBatch& batch, sBatchFeatures& out)
+{
+	static_assert(BoardBatch::LANES == 16, "AVX2 kernel processes 16 lanes per register");
+
+	const int width = batch.GetWidth();
+
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi16(1);
+	const __m256i walls = _mm256_set1_epi16(static_cast<short>(1 | (1 << (width + 1))));
+	const __m256i wallMask = _mm256_set1_epi16(static_cast<short>((1 << (width + 1)) - 1));
+
+	__m256i heights[Board::MAX_WIDTH];
+	for (int x = 0; x < width; ++x)
+		heights[x] = zero;
+
+	__m256i covered = zero;
+	__m256i filled = zero;
+	__m256i transitions = zero;
+
+	for (int y = 0; y < BOARD_HEIGHT; ++y)
+	{
+		const __m256i row = _mm256_load_si256(reinterpret_cast<const __m256i*>(batch.GetRowLanes(y)));
+		covered = _mm256_or_si256(covered, row);
+
+		__m256i bits = covered;
+		for (int x = 0; x < width; ++x)
+		{
+			heights[x] = _mm256_add_epi16(heights[x], _mm256_and_si256(bits, one));
+			bits = _mm256_srli_epi16(bits, 1);
+		}
+
+		const __m256i walled = _mm256_or_si256(_mm256_slli_epi16(row, 1), walls);
+		transitions = _mm256_add_epi16(transitions, PopCount16(_mm256_and_si256(_mm256_xor_si256(walled, _mm256_srli_epi16(walled, 1)), wallMask)));
+		filled = _mm256_add_epi16(filled, PopCount16(row));
+	}
+
+	const __m256i wallHeight = _mm256_set1_epi16(BOARD_HEIGHT);
+	__m256i aggregate = zero, maxHeight = zero, bumpiness = zero, wells = zero;
+
+	for (int x = 0; x < width; ++x)
+	{
+		const __m256i h = heights[x];
+		const __m256i left = (x > 0) ? heights[x - 1] : wallHeight;
+		const __m256i right = (x + 1 < width) ? heights[x + 1] : wallHeight;
+
+		aggregate = _mm256_add_epi16(aggregate, h);
+		maxHeight = _mm256_max_epi16(maxHeight, h);
+		wells = _mm256_add_epi16(wells, _mm256_max_epi16(_mm256_sub_epi16(_mm256_min_epi16(left, right), h), zero));
+		if (x + 1 < width)
+			bumpiness = _mm256_add_epi16(bumpiness, _mm256_abs_epi16(_mm256_sub_epi16(h, right)));
+	}
+
+	_mm256_store_si256(reinterpret_cast<__m256i*>(out.aggregateHeight.data()), aggregate);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(out.maxHeight.data()), maxHeight);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(out.holes.data()), _mm256_sub_epi16(aggregate, filled));
+	_mm256_store_si256(reinterpret_cast<__m256i*>(out.bumpiness.data()), bumpiness);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(out.wells.data()), wells);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(out.rowTransitions.data()), transitions);
+}
+
+#endif // TETRIS_BATCH_X86
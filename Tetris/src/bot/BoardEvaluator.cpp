@@ -0,0 +1,85 @@
+﻿#include "BoardEvaluator.h"
+#include "../Board.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+namespace
+{
+	int CountBits(uint32_t mask)
+	{
+		int count = 0;
+		for (; mask; mask &= mask - 1)
+			++count;
+
+		return count;
+	}
+}
+
+int BoardEvaluator::CountRowTransitions(uint16_t row, int width)
+{
+	// 양쪽 벽을 블록으로 채운 (width + 2) 비트에서 인접 비트가 다른 곳의 수
+	const uint32_t wallMask = (1u << (width + 1)) - 1;
+	const uint32_t walled = (static_cast<uint32_t>(row) << 1) | 1u | (1u << (width + 1));
+	return CountBits((walled ^ (walled >> 1)) & wallMask);
+}
+
+int BoardEvaluator::CountRowTransitions(const Board& board)
+{
+	int transitions = 0;
+	for (int y = 0; y < board.GetHeight(); ++y)
+		transitions += CountRowTransitions(board.GetRow(y), board.GetWidth());
+
+	return transitions;
+}
+
+sBoardFeatures BoardEvaluator::Extract(const Board& board)
+{
+	sBoardFeatures f;
+
+	const int width = board.GetWidth();
+	const int height = board.GetHeight();
+
+	std::array<int, Board::MAX_WIDTH> heights{};
+	for (int x = 0; x < width; ++x)
+	{
+		heights[static_cast<size_t>(x)] = board.GetColumnHeight(x);
+		f.aggregateHeight += heights[static_cast<size_t>(x)];
+		f.maxHeight = std::max(f.maxHeight, heights[static_cast<size_t>(x)]);
+	}
+
+	for (int x = 0; x + 1 < width; ++x)
+		f.bumpiness += std::abs(heights[static_cast<size_t>(x)] - heights[static_cast<size_t>(x + 1)]);
+
+	for (int x = 0; x < width; ++x)
+	{
+		const int left = (x > 0) ? heights[static_cast<size_t>(x - 1)] : height;
+		const int right = (x + 1 < width) ? heights[static_cast<size_t>(x + 1)] : height;
+		const int depth = std::min(left, right) - heights[static_cast<size_t>(x)];
+		if (depth > 0)
+			f.wells += depth;
+	}
+
+	// 위에서부터 내려오며 "위에 블록이 있는 열" 마스크를 누적
+	uint16_t covered = 0;
+	for (int y = height - f.maxHeight; y < height; ++y)
+	{
+		const uint16_t row = board.GetRow(y);
+		f.holes += CountBits(static_cast<uint16_t>(covered & ~row));
+		covered |= row;
+	}
+
+	f.rowTransitions = CountRowTransitions(board);
+
+	return f;
+}
+
+double BoardEvaluator::Score(const sBoardFeatures& features, int linesCleared, const sEvalWeights& weights)
+{
+	return weights.aggregateHeight * features.aggregateHeight
+		+ weights.linesCleared * linesCleared
+		+ weights.holes * features.holes
+		+ weights.bumpiness * features.bumpiness
+		+ weights.wells * features.wells
+		+ weights.rowTransitions * features.rowTransitions;
+}
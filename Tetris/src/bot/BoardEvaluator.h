@@ -0,0 +1,42 @@
+﻿#pragma once
+
+#include <cstdint>
+
+class Board;
+
+// --------------------------------------------------------------------
+//  봇이 배치 후보를 비교할 때 사용하는 보드 특징값
+// --------------------------------------------------------------------
+struct sBoardFeatures
+{
+	int aggregateHeight{ 0 };	// 열 높이 합
+	int maxHeight{ 0 };
+	int holes{ 0 };				// 위가 막힌 빈 칸 수
+	int bumpiness{ 0 };			// 인접 열 높이 차이 합
+	int wells{ 0 };				// 양옆보다 낮은 열의 깊이 합 (벽은 무한히 높다고 봄)
+	int rowTransitions{ 0 };	// 행 안에서 빈 칸 ↔ 블록이 바뀌는 횟수 (벽은 블록으로 봄)
+};
+
+// 특징값별 가중치 (양수: 선호, 음수: 회피)
+struct sEvalWeights
+{
+	double aggregateHeight{ -0.510 };
+	double linesCleared{ 0.760 };
+	double holes{ -0.357 };
+	double bumpiness{ -0.184 };
+	double wells{ -0.100 };
+	double rowTransitions{ -0.050 };
+};
+
+namespace BoardEvaluator
+{
+	// 행 비트마스크와 열 높이 캐시만으로 특징값 계산 (셀 단위 조회 없음)
+	sBoardFeatures Extract(const Board& board);
+
+	// 행 하나 / 보드 전체의 행 전이 수 (빈 행도 양쪽 벽 때문에 2)
+	int CountRowTransitions(uint16_t row, int width);
+	int CountRowTransitions(const Board& board);
+
+	// 배치 후 보드 특징값 + 그 배치로 지운 줄 수의 가중합
+	double Score(const sBoardFeatures& features, int linesCleared, const sEvalWeights& weights);
+}
@@ -0,0 +1,313 @@
+﻿#include "BotController.h"
+#include "../Tetromino.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+
+using namespace Tetris;
+
+namespace
+{
+	// 경로 입력 하나를 적용한 자세 (홀드 / 하드 드롭은 그대로)
+	sPiecePose ApplyMove(sPiecePose pose, uint8_t input)
+	{
+		switch (input)
+		{
+		case INPUT_LEFT:        --pose.x; break;
+		case INPUT_RIGHT:       ++pose.x; break;
+		case INPUT_SOFT_DROP:   ++pose.y; break;
+		case INPUT_ROTATE_CW:   pose.rot = NextCW(pose.rot); break;
+		case INPUT_ROTATE_CCW:  pose.rot = NextCCW(pose.rot); break;
+		default: break;
+		}
+		return pose;
+	}
+}
+
+BotController::BotController(const sBotConfig& config)
+	: m_Config{ config }
+{
+	m_Candidates.reserve(128);
+	m_LookaheadCandidates.reserve(128);
+
+	m_Kernel = BoardBatchKernel::GetBest();
+	TETRIS_LOG("BotController: batch eval kernel = " + std::string(BoardBatchKernel::GetName(m_Kernel)));
+
+	m_Worker = std::thread([this]() { WorkerLoop(); });
+}
+
+BotController::~BotController()
+{
+	{
+		std::scoped_lock lock(m_RequestMutex);
+		m_bStop = true;
+	}
+	m_RequestCv.notify_one();
+
+	if (m_Worker.joinable())
+		m_Worker.join();
+}
+
+void BotController::Request(const sBotRequest& request)
+{
+	// 이전 미노 (또는 어긋난 경로) 의 남은 입력은 더 이상 의미 없음
+	++m_CurRequestId;
+	m_ActiveIndex = -1;
+	m_bNeedsReplan = false;
+
+	m_ActiveBoard = request.board;
+	m_ExpectedType = request.curType;
+	m_Expected = request.curPose;
+
+	{
+		std::scoped_lock lock(m_RequestMutex);
+		m_Request = request;
+		m_RequestId = m_CurRequestId;
+		m_bHasRequest = true;
+	}
+	m_RequestCv.notify_one();
+}
+
+uint8_t BotController::NextInput(uint64_t nowMS, const Tetromino* cur)
+{
+	if (m_ActiveIndex < 0)
+	{
+		std::scoped_lock lock(m_PlanMutex);
+		if (!m_bHasPlan)
+			return INPUT_NONE;
+
+		m_bHasPlan = false;
+
+		// 탐색 중에 다음 미노로 넘어갔거나 다시 요청했으면 버림
+		if (m_Plan.requestId != m_CurRequestId)
+			return INPUT_NONE;
+
+		m_Active = m_Plan.placement;
+		m_ActiveIndex = 0;
+	}
+
+	if (m_ActiveIndex >= m_Active.pathLength || !cur)
+		return INPUT_NONE;
+
+	// 입력 간격을 기다리는 동안에도 중력이 진행되므로 매 호출 확인
+	if (!Reconcile(*cur))
+	{
+		m_ActiveIndex = -1;
+		m_bNeedsReplan = true;
+		return INPUT_NONE;
+	}
+
+	if (nowMS - m_LastInputMS < m_Config.inputIntervalMS)
+		return INPUT_NONE;
+
+	m_LastInputMS = nowMS;
+
+	const uint8_t input = m_Active.path[static_cast<size_t>(m_ActiveIndex++)];
+	if (input == INPUT_HOLD)
+	{
+		// 홀드로 나온 미노는 스폰 위치에서 다시 시작
+		m_ExpectedType = m_Active.type;
+		m_Expected = MoveGenerator::GetSpawnPose();
+	}
+	else
+	{
+		m_Expected = ApplyMove(m_Expected, input);
+	}
+
+	return input;
+}
+
+bool BotController::Reconcile(const Tetromino& cur)
+{
+	// 홀드 직전 자세는 결과와 무관
+	if (m_Active.path[static_cast<size_t>(m_ActiveIndex)] == INPUT_HOLD)
+		return true;
+
+	const bool bSameColumn = cur.GetType() == m_ExpectedType && cur.GetX() == m_Expected.x && cur.GetRotation() == m_Expected.rot;
+
+	// 중력이 이미 내려 준 만큼 소프트 드롭은 건너뜀 (경로 끝은 항상 하드 드롭이라 범위를 넘지 않음)
+	while (bSameColumn && cur.GetY() > m_Expected.y && m_Active.path[static_cast<size_t>(m_ActiveIndex)] == INPUT_SOFT_DROP)
+	{
+		++m_Expected.y;
+		++m_ActiveIndex;
+	}
+
+	if (bSameColumn && cur.GetY() == m_Expected.y)
+		return true;
+
+	// 더 내려왔어도 남은 이동이 막히지 않고 같은 곳에 떨어지면 그대로 진행
+	if (cur.GetType() != m_ExpectedType || !IsPathValidFrom(cur))
+		return false;
+
+	m_Expected = { cur.GetX(), cur.GetY(), cur.GetRotation() };
+	return true;
+}
+
+bool BotController::IsPathValidFrom(const Tetromino& cur) const
+{
+	Tetromino mino = cur;
+
+	for (int i = m_ActiveIndex; i < m_Active.pathLength; ++i)
+	{
+		const uint8_t input = m_Active.path[static_cast<size_t>(i)];
+
+		if (input == INPUT_HARD_DROP)
+		{
+			const int landY = mino.GetY() + m_ActiveBoard.DropDistance(mino);
+			return mino.GetX() == m_Active.x && landY == m_Active.y && mino.GetRotation() == m_Active.rot;
+		}
+
+		// GameEngine 과 같은 판정 (벽킥 없음, 막히면 그 입력은 무시되므로 경로가 어긋남)
+		const sPiecePose next = ApplyMove({ mino.GetX(), mino.GetY(), mino.GetRotation() }, input);
+		if (m_ActiveBoard.IsCollide(mino, next.x - mino.GetX(), next.y - mino.GetY(), next.rot))
+			return false;
+
+		mino.SetPos(next.x, next.y);
+		mino.SetRotation(next.rot);
+	}
+
+	return false;
+}
+
+void BotController::WorkerLoop()
+{
+	sBotRequest request;
+	uint32_t requestId = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_RequestMutex);
+			m_RequestCv.wait(lock, [this]() { return m_bHasRequest || m_bStop; });
+
+			if (m_bStop)
+				return;
+
+			request = m_Request;
+			requestId = m_RequestId;
+			m_bHasRequest = false;
+		}
+
+		sPlacement best;
+		if (!Think(request, best))
+			continue;
+
+		{
+			std::scoped_lock lock(m_PlanMutex);
+			m_Plan.requestId = requestId;
+			m_Plan.placement = best;
+			m_bHasPlan = true;
+		}
+
+		m_PlannedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+bool BotController::Think(const sBotRequest& request, sPlacement& outBest)
+{
+	using Clock = std::chrono::steady_clock;
+
+	const bool bHasDeadline = m_Config.thinkBudgetMS > 0;
+	const auto deadline = Clock::now() + std::chrono::milliseconds(m_Config.thinkBudgetMS);
+
+	m_Candidates.clear();
+	m_Generator.GenerateWithHold(request.board, request.curType, request.curPose, request.holdType, request.preview[0],
+		m_Config.bUseHold && request.bCanHold, m_Candidates);
+
+	if (m_Candidates.empty())
+		return false;
+
+	// --- 1수 평가 (BoardBatch 로 16개씩 묶어 SIMD 커널로 특징값 계산) ---
+	ScorePlacements(request.board, m_Candidates, m_Scores);
+
+	std::vector<std::pair<double, size_t>> scored;
+	scored.reserve(m_Candidates.size());
+	for (size_t i = 0; i < m_Candidates.size(); ++i)
+		scored.emplace_back(m_Scores[i], i);
+
+	std::stable_sort(scored.begin(), scored.end(),
+		[](const auto& a, const auto& b) { return a.first > b.first; });
+
+	outBest = m_Candidates[scored.front().second];
+
+	if (!m_Config.bLookahead)
+		return true;
+
+	// --- 2수 평가: 1수 점수가 높은 후보부터, 시간이 남는 동안만 ---
+	double bestTotal = -std::numeric_limits<double>::infinity();
+	bool bFoundLookahead = false;
+	Board after;
+
+	for (const auto& entry : scored)
+	{
+		if (bHasDeadline && Clock::now() >= deadline)
+		{
+			m_TimeoutCount.fetch_add(1, std::memory_order_relaxed);
+			break;
+		}
+
+		const sPlacement& first = m_Candidates[entry.second];
+
+		// 홀드가 비어 있는 상태에서 홀드하면 preview[0] 을 소비하므로 다음 미노가 한 칸 밀림
+		const bool bConsumedNext = first.bUseHold && request.holdType == TetrominoType::None;
+		const TetrominoType nextType = request.preview[bConsumedNext ? 1 : 0];
+
+		// 첫 수로 지운 줄은 보너스로 더하고, 보드 모양은 두 번째 수 이후 보드로 평가
+		const int cleared = ApplyPlacement(request.board, first, after);
+		const double firstLinesBonus = m_Config.weights.linesCleared * cleared;
+
+		m_LookaheadCandidates.clear();
+		m_LookaheadGenerator.Generate(after, nextType, m_LookaheadCandidates);
+		ScorePlacements(after, m_LookaheadCandidates, m_LookaheadScores);
+
+		// 다음 미노를 놓을 곳이 없으면 사실상 패배 수
+		double bestSecond = -std::numeric_limits<double>::infinity();
+		for (double score : m_LookaheadScores)
+			bestSecond = std::max(bestSecond, score);
+
+		const double total = firstLinesBonus + bestSecond;
+		if (!bFoundLookahead || total > bestTotal)
+		{
+			bestTotal = total;
+			outBest = first;
+			bFoundLookahead = true;
+		}
+	}
+
+	return true;
+}
+
+void BotController::ScorePlacements(const Board& board, const std::vector<sPlacement>& placements, std::vector<double>& outScores)
+{
+	outScores.resize(placements.size());
+
+	for (size_t begin = 0; begin < placements.size(); begin += BoardBatch::LANES)
+	{
+		const size_t end = std::min(placements.size(), begin + BoardBatch::LANES);
+
+		m_Batch.Reset(board);
+		for (size_t i = begin; i < end; ++i)
+			m_Batch.Push(placements[i]);
+
+		BoardBatchKernel::Evaluate(m_Batch, m_BatchFeatures, m_Kernel);
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			const int lane = static_cast<int>(i - begin);
+			outScores[i] = BoardEvaluator::Score(m_BatchFeatures.Get(lane), m_Batch.GetLinesCleared(lane), m_Config.weights);
+		}
+	}
+}
+
+int BotController::ApplyPlacement(const Board& board, const sPlacement& placement, Board& afterBoard) const
+{
+	Tetromino mino(placement.type);
+	mino.SetPos(placement.x, placement.y);
+	mino.SetRotation(placement.rot);
+
+	afterBoard = board;
+	afterBoard.Lock(mino);
+	return afterBoard.ClearFullLines();
+}
@@ -0,0 +1,145 @@
+﻿#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "BoardBatch.h"
+#include "BoardEvaluator.h"
+#include "../Board.h"
+#include "../GameConfig.h"
+#include "../common/TetrisTypes.h"
+#include "../engine/MoveGenerator.h"
+
+class Tetromino;
+
+struct sBotConfig
+{
+	// 미노당 탐색 시간 (0 이면 제한 없음 → 같은 시드/입력이면 항상 같은 수)
+	uint32_t thinkBudgetMS{ GameConfig::BotThinkBudgetMS };
+
+	// 계획한 입력을 하나씩 내보내는 간격 (사람처럼 보이게 하는 속도 조절)
+	uint32_t inputIntervalMS{ GameConfig::BotInputIntervalMS };
+
+	bool bUseHold{ true };
+	bool bLookahead{ true };	// 다음 미노까지 고려한 2수 탐색
+
+	sEvalWeights weights{};
+};
+
+// --------------------------------------------------------------------
+//  한 미노에 대한 탐색 요청 (게임 스레드 → 워커)
+// --------------------------------------------------------------------
+struct sBotRequest
+{
+	Board board{};
+	Tetris::TetrominoType curType{ Tetris::TetrominoType::None };
+	sPiecePose curPose{ MoveGenerator::GetSpawnPose() };		// 경로 시작 자세 (재계획이면 현재 위치)
+	Tetris::TetrominoType holdType{ Tetris::TetrominoType::None };
+	std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT> preview{};
+	bool bCanHold{ true };
+};
+
+// --------------------------------------------------------------------
+//  GameEngine 한쪽을 조작하는 봇
+//
+//  - 게임 스레드는 새 미노가 나올 때 Request 로 상태 스냅샷을 넘기고,
+//    매 프레임 NextInput 으로 입력을 하나씩 받아 엔진 Step 에 전달
+//  - 배치 탐색/평가는 워커 스레드에서 thinkBudgetMS 안에 수행하며,
+//    시간이 다 되면 그때까지의 최선 수를 게시하므로 게임 루프가 멈추지 않음
+//  - 탐색 / 입력 간격 동안에도 중력은 흐르므로 입력마다 실제 미노를 경로가 예상한 자세와 비교
+//    중력이 대신한 소프트 드롭은 건너뛰고, 남은 경로로 목표에 못 가면 NeedsReplan → 현재 자세에서 다시 요청
+// --------------------------------------------------------------------
+class BotController
+{
+public:
+	explicit BotController(const sBotConfig& config = sBotConfig());
+	~BotController();
+
+	BotController(const BotController&) = delete;
+	BotController& operator=(const BotController&) = delete;
+
+	// 새 미노 (또는 재계획) 탐색 요청 (이전 요청/계획은 버림)
+	void Request(const sBotRequest& request);
+
+	// nowMS 기준으로 보낼 입력이 있으면 반환 (없으면 INPUT_NONE)
+	// cur: 이번 Step 전 엔진의 현재 미노
+	uint8_t NextInput(uint64_t nowMS, const Tetromino* cur);
+
+	// 실행 중인 경로가 어긋나 현재 자세에서 다시 Request 해야 함
+	const bool NeedsReplan() const { return m_bNeedsReplan; }
+
+	// 워커가 지금까지 계획을 게시한 미노 수 / 시간 초과로 조기 종료한 횟수
+	const uint32_t GetPlannedCount() const { return m_PlannedCount.load(std::memory_order_relaxed); }
+	const uint32_t GetTimeoutCount() const { return m_TimeoutCount.load(std::memory_order_relaxed); }
+
+private:
+	struct sBotPlan
+	{
+		uint32_t requestId{ 0 };
+		sPlacement placement{};
+	};
+
+	void WorkerLoop();
+
+	// 실제 미노가 경로의 예상 자세와 다르면 맞춤. 남은 경로로 목표에 갈 수 없으면 false
+	bool Reconcile(const Tetromino& cur);
+
+	// cur 에서 남은 경로를 그대로 밟으면 계획한 배치에 도착하는지
+	bool IsPathValidFrom(const Tetromino& cur) const;
+
+	// request 에 대한 최선 배치 탐색. 찾은 배치가 없으면 false
+	bool Think(const sBotRequest& request, sPlacement& outBest);
+
+	// board 위 각 배치의 평가 점수 (outScores[i] ↔ placements[i])
+	void ScorePlacements(const Board& board, const std::vector<sPlacement>& placements, std::vector<double>& outScores);
+
+	// 배치 하나를 보드에 적용 (afterBoard 에 결과 보드), 지운 줄 수 반환
+	int ApplyPlacement(const Board& board, const sPlacement& placement, Board& afterBoard) const;
+
+private:
+	sBotConfig m_Config;
+
+	// --- 워커 전용 ---
+	MoveGenerator m_Generator;
+	MoveGenerator m_LookaheadGenerator;
+	std::vector<sPlacement> m_Candidates;
+	std::vector<sPlacement> m_LookaheadCandidates;
+	std::vector<double> m_Scores;
+	std::vector<double> m_LookaheadScores;
+
+	BatchKernel m_Kernel{ BatchKernel::Scalar };
+	BoardBatch m_Batch;
+	sBatchFeatures m_BatchFeatures;
+
+	// --- 요청 (게임 스레드 → 워커, 최신 1개만 유지) ---
+	std::mutex m_RequestMutex;
+	std::condition_variable m_RequestCv;
+	sBotRequest m_Request{};
+	uint32_t m_RequestId{ 0 };
+	bool m_bHasRequest{ false };
+	bool m_bStop{ false };
+
+	// --- 계획 (워커 → 게임 스레드) ---
+	std::mutex m_PlanMutex;
+	sBotPlan m_Plan{};
+	bool m_bHasPlan{ false };
+
+	// --- 게임 스레드 전용 ---
+	uint32_t m_CurRequestId{ 0 };
+	Board m_ActiveBoard{};						// 요청 시점 보드 (미노가 고정될 때까지 그대로)
+	Tetris::TetrominoType m_ExpectedType{ Tetris::TetrominoType::None };
+	sPiecePose m_Expected{};					// 다음 입력 직전 경로가 예상하는 자세
+	sPlacement m_Active{};
+	int m_ActiveIndex{ -1 };		// -1: 실행 중인 계획 없음
+	uint64_t m_LastInputMS{ 0 };
+	bool m_bNeedsReplan{ false };
+
+	std::atomic<uint32_t> m_PlannedCount{ 0 };
+	std::atomic<uint32_t> m_TimeoutCount{ 0 };
+
+	std::thread m_Worker;
+};
@@ -1,11 +1,18 @@
 #pragma once
 
+// 서버는 클라이언트 엔진 소스 (GameEngine) 를 함께 빌드하므로
+// 클라이언트 / 서버 사본이 한 TU 에 같이 포함될 수 있음 → 같은 매크로로 한 번만 정의
+#ifndef TETRIS_PACKET_PROTOCOL_H
+#define TETRIS_PACKET_PROTOCOL_H
+
 #include <sp_net.h>
+#include <array>
+#include <type_traits>
 
 enum class GameMsg : uint32_t
 {
     // ------------------------------
-    // Connection Handshake ()
+    // Connection Handshake (공통)
     // ------------------------------
     Client_Accepted,
     Client_AssignID,
@@ -20,19 +27,19 @@ enum class GameMsg : uint32_t
     // ------------------------------
     // Lobby / Room Join Flow
     // ------------------------------
-    Client_RequestRoomJoin,     // Ŭ̾Ʈ  :   û
-    Server_RoomJoinAccepted,    //   Ŭ:   
-    Server_RoomJoinDenied,      //   Ŭ:   Ұ(ο ʰ )
-    Server_RoomPlayerList,      //   Ŭ:     
-    Server_RoomPlayerJoined,    //   Ŭ: ο ÷̾ 
-    Server_RoomPlayerLeft,      //   Ŭ: ÷̾ 
+    Client_RequestRoomJoin,     // 클라이언트 → 서버: 룸 참가 요청 (매칭 대기열 등록, body 선택: sNetU32 레이팅)
+    Server_RoomJoinAccepted,    // 서버 → 클라: 룸 참가 승인
+    Server_RoomJoinDenied,      // 서버 → 클라: 룸 참가 불가(인원 초과 등)
+    Server_RoomPlayerList,      // 서버 → 클라: 현재 방 참여자 목록 갱신
+    Server_RoomPlayerJoined,    // 서버 → 클라: 새로운 플레이어 입장
+    Server_RoomPlayerLeft,      // 서버 → 클라: 플레이어 퇴장
 
     // ------------------------------
     // Ready / Start Game 
     // ------------------------------
-    Client_Ready,               // Ŭ  : غ Ϸ (ɼ)
-    Client_CancelReady,         // Ŭ  : غ  (ɼ)
-    Server_AllPlayersReady,     //   Ŭ:  ÷̾ غ (MultiPlayState )
+    Client_Ready,               // 클라 → 서버: 준비 완료 (옵션)
+    Client_CancelReady,         // 클라 → 서버: 준비 취소 (옵션)
+    Server_AllPlayersReady,     // 서버 → 클라: 모든 플레이어 준비됨 (MultiPlayState로 전이, body 선택: NetSyncMode)
 
     // ------------------------------
     // Game
@@ -41,7 +48,7 @@ enum class GameMsg : uint32_t
     Game_RemovePlayer,
     Game_UpdatePlayer,
 
-    Game_Start,                 //   Ŭ:   ȣ
+    Game_Start,                 // 서버 → 클라: 게임 시작 신호
     Game_SendBagSeed,
 
     Game_BoardState,
@@ -51,16 +58,76 @@ enum class GameMsg : uint32_t
     Game_PlayerDead,
 
     Server_GameOver,
+
+    Game_BoardDelta,            // 마지막으로 보낸 보드 버전 대비 바뀐 행만 전송 (sBoardDeltaHeader)
+    Game_BoardResyncRequest,    // 수신 측이 버전 누락을 감지 → 보드 소유자에게 키프레임 요청
+
+    Game_InputBatch,            // 권한 모드 (sInputBatchHeader)
+                                //  클라 → 서버: 마지막 전송 이후의 자기 입력 + 진행한 tick
+                                //  서버 → 클라: 상대의 확정 입력 (서버가 적용한 tick) + 서버 엔진 tick
+    Game_InputCorrection,       // 서버 → 클라 (권한 모드): 입력이 보낸 것과 다른 tick 에 적용됨 (sInputCorrection)
+    Game_InputAck,              // 서버 → 클라 (권한 모드): 이 tick 까지 보낸 입력은 확정 (sNetU32)
 };
 
+constexpr uint32_t NET_DEFAULT_RATING = 1000;
+
 struct sPlayerDescription
 {
     uint32_t nUniqueID = 0;
     uint32_t nAvatarID = 0;
+    uint32_t nRating = NET_DEFAULT_RATING;      // 매칭에 사용
 
-    // TODO : ÷̾ ʿ ʵ ä
+    // TODO : 플레이어 필요한 필드 채우기
 };
 
+// ------------------------------
+// Wire Encoding
+//  message 로 보내는 body 는 모두 바이트 단위 필드로만 구성 (패딩 없음, 정렬 1)
+//  다중 바이트 정수는 sNetLE 로 리틀 엔디언 고정 → MSVC / GCC / Clang 빌드 간 동일한 바이트열
+//  레이아웃이 바뀌면 NET_WIRE_VERSION 을 올림 (수신 측은 버전이 다른 패킷을 버림)
+// ------------------------------
+constexpr uint8_t NET_WIRE_VERSION = 1;
+
+// 게임 패킷 body 상한 (가장 큰 패킷은 보드 델타 키프레임, 약 150바이트)
+// 이보다 큰 header.size 를 받으면 연결을 끊음
+constexpr uint32_t NET_MAX_MESSAGE_SIZE = 4 * 1024;
+
+template <typename T>
+struct sNetLE
+{
+    static_assert(std::is_unsigned<T>::value, "sNetLE holds unsigned integers");
+
+    std::array<uint8_t, sizeof(T)> bytes{};
+
+    sNetLE() = default;
+    sNetLE(T value) { Set(value); }
+
+    void Set(T value)
+    {
+        for (size_t i = 0; i < sizeof(T); ++i)
+            bytes[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+
+    T Get() const
+    {
+        T value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+            value |= static_cast<T>(bytes[i]) << (i * 8);
+        return value;
+    }
+};
+
+using sNetU32 = sNetLE<uint32_t>;
+using sNetU64 = sNetLE<uint64_t>;
+
+static_assert(sizeof(sNetU32) == 4 && alignof(sNetU32) == 1, "sNetU32 layout");
+static_assert(sizeof(sNetU64) == 8 && alignof(sNetU64) == 1, "sNetU64 layout");
+
+// ------------------------------
+// Mino State
+//  sMinoState 는 양쪽 로직이 쓰는 값 (직접 전송하지 않음)
+//  전송은 sMinoStateWire (4바이트)
+// ------------------------------
 struct sMinoState
 {
     int32_t type = 0;  // Tetrominotype [1..7]
@@ -69,13 +136,92 @@ struct sMinoState
     int32_t rot = 0;   // rotation enum [0..3]
 };
 
+struct sMinoStateWire
+{
+    uint8_t version = NET_WIRE_VERSION;
+    uint8_t typeRot = 0;    // 하위 4비트: type, 상위 4비트: rot
+    int8_t x = 0;           // 피벗 좌표 (보드 밖 음수 허용)
+    int8_t y = 0;
+};
+
+static_assert(sizeof(sMinoStateWire) == 4, "sMinoStateWire layout");
+
+inline sMinoStateWire PackMinoState(const sMinoState& state)
+{
+    sMinoStateWire wire;
+    wire.typeRot = static_cast<uint8_t>((state.type & 0x0F) | ((state.rot & 0x0F) << 4));
+    wire.x = static_cast<int8_t>(state.x);
+    wire.y = static_cast<int8_t>(state.y);
+    return wire;
+}
+
+inline bool UnpackMinoState(const sMinoStateWire& wire, sMinoState& out)
+{
+    if (wire.version != NET_WIRE_VERSION)
+        return false;
+
+    out.type = wire.typeRot & 0x0F;
+    out.rot = wire.typeRot >> 4;
+    out.x = wire.x;
+    out.y = wire.y;
 
+    // None(0) 은 TetrominoTable 인덱스 밖이므로 거부 (릴레이 서버는 body 크기만 검사)
+    return 1 <= out.type && out.type <= 7 && out.rot <= 3;
+}
+
+// ------------------------------
+// Preview
+//  전송: 미노당 3비트 x 5개 = 15비트 (i 번째 미노 = 비트 [3i, 3i + 3), 리틀 엔디언)
+// ------------------------------
 constexpr uint16_t NET_PREVIEW_MINO_COUNT = 5;
+constexpr uint16_t NET_PREVIEW_TYPE_BITS = 3;
+
 struct sPreviewMinoState
 {
     std::array< int32_t, NET_PREVIEW_MINO_COUNT> previewTypes{};
 };
 
+struct sPreviewMinoStateWire
+{
+    uint8_t version = NET_WIRE_VERSION;
+    std::array<uint8_t, 2> types{};
+};
+
+static_assert(NET_PREVIEW_MINO_COUNT * NET_PREVIEW_TYPE_BITS <= 16, "preview types fit in 16 bits");
+static_assert(sizeof(sPreviewMinoStateWire) == 3, "sPreviewMinoStateWire layout");
+
+inline sPreviewMinoStateWire PackPreviewState(const sPreviewMinoState& state)
+{
+    uint16_t bits = 0;
+    for (int i = 0; i < NET_PREVIEW_MINO_COUNT; ++i)
+        bits |= static_cast<uint16_t>((state.previewTypes[i] & 0x07) << (i * NET_PREVIEW_TYPE_BITS));
+
+    sPreviewMinoStateWire wire;
+    wire.types[0] = static_cast<uint8_t>(bits);
+    wire.types[1] = static_cast<uint8_t>(bits >> 8);
+    return wire;
+}
+
+inline bool UnpackPreviewState(const sPreviewMinoStateWire& wire, sPreviewMinoState& out)
+{
+    if (wire.version != NET_WIRE_VERSION)
+        return false;
+
+    const uint16_t bits = static_cast<uint16_t>(wire.types[0] | (wire.types[1] << 8));
+    for (int i = 0; i < NET_PREVIEW_MINO_COUNT; ++i)
+    {
+        out.previewTypes[i] = (bits >> (i * NET_PREVIEW_TYPE_BITS)) & 0x07;
+        if (out.previewTypes[i] == 0)
+            return false;
+    }
+
+    return true;
+}
+
+// ------------------------------
+// Board State (키프레임 전체 보드)
+//  전송: 칸당 4비트 (i 짝수: 하위 니블, i 홀수: 상위 니블)
+// ------------------------------
 constexpr uint16_t NET_BOARD_WIDTH = 10;
 constexpr uint16_t NET_BOARD_HEIGHT = 3 + 20;
 constexpr uint16_t NET_BOARD_CELLS = NET_BOARD_WIDTH * NET_BOARD_HEIGHT;
@@ -85,8 +231,192 @@ struct sBoardState
     std::array<int, NET_BOARD_CELLS> cells{};
 };
 
+struct sBoardStateWire
+{
+    uint8_t version = NET_WIRE_VERSION;
+    std::array<uint8_t, (NET_BOARD_CELLS + 1) / 2> cells{};
+};
+
+static_assert(sizeof(sBoardStateWire) == 1 + (NET_BOARD_CELLS + 1) / 2, "sBoardStateWire layout");
+
+inline sBoardStateWire PackBoardState(const sBoardState& state)
+{
+    sBoardStateWire wire;
+    for (int i = 0; i < NET_BOARD_CELLS; ++i)
+        wire.cells[i / 2] |= static_cast<uint8_t>((state.cells[i] & 0x0F) << ((i & 1) * 4));
+    return wire;
+}
+
+inline bool UnpackBoardState(const sBoardStateWire& wire, sBoardState& out)
+{
+    if (wire.version != NET_WIRE_VERSION)
+        return false;
+
+    for (int i = 0; i < NET_BOARD_CELLS; ++i)
+        out.cells[i] = (wire.cells[i / 2] >> ((i & 1) * 4)) & 0x0F;
+    return true;
+}
+
+// ------------------------------
+// Board Delta
+//  body 순서 (message 는 뒤에서부터 꺼내므로 헤더를 마지막에 push)
+//  [sBoardDeltaRow x rowCount][sBoardDeltaHeader]
+//
+//  수신 측 적용 순서: (키프레임이면 보드 비움) → clearedRows 제거 후 위 행을 아래로 당김 → rows 덮어쓰기
+// ------------------------------
+constexpr uint8_t NET_BOARD_DELTA_KEYFRAME = 1 << 0;
+constexpr uint16_t NET_BOARD_MAX_CLEARED = 4;
+constexpr uint16_t NET_BOARD_ROW_BYTES = (NET_BOARD_WIDTH + 1) / 2;    // 칸당 4비트
+
+struct sBoardDeltaHeader
+{
+    sNetU32 version;                // 이 델타를 적용한 뒤의 보드 버전
+    sNetU32 baseVersion;            // 이 델타의 기준 버전 (키프레임이면 무시)
+    uint8_t flags = 0;              // NET_BOARD_DELTA_KEYFRAME
+    uint8_t clearedCount = 0;
+    uint8_t rowCount = 0;
+    uint8_t wireVersion = NET_WIRE_VERSION;
+    std::array<uint8_t, NET_BOARD_MAX_CLEARED> clearedRows{};   // 제거 전 보드 기준 행 인덱스 (아래 → 위)
+};
+
+struct sBoardDeltaRow
+{
+    uint8_t y = 0;
+    std::array<uint8_t, NET_BOARD_ROW_BYTES> cells{};  // x 짝수: 하위 니블, x 홀수: 상위 니블
+};
+
+static_assert(sizeof(sBoardDeltaHeader) == 16, "sBoardDeltaHeader layout");
+static_assert(sizeof(sBoardDeltaRow) == 1 + NET_BOARD_ROW_BYTES, "sBoardDeltaRow layout");
+
 struct sGameOverInfo
 {
-    uint32_t nWinnerID = 0;
-    uint32_t nLoserID = 0;
-};
\ No newline at end of file
+    sNetU32 nWinnerID;
+    sNetU32 nLoserID;
+};
+
+static_assert(sizeof(sGameOverInfo) == 8, "sGameOverInfo layout");
+
+// ------------------------------
+// Sync Mode (Server_AllPlayersReady body, 없으면 Relay)
+//  Relay         : 각 클라이언트가 자기 상태 (미노 / 홀드 / 미리보기 / 보드 델타) 를 보내고 서버는 상대에게 전달
+//  Authoritative : 클라이언트는 입력만 보내고, 서버가 플레이어마다 엔진을 돌려 검증한 입력을 상대에게 중계
+//                  클라이언트는 두 플레이어 모두 같은 엔진으로 예측하고 확정 입력이 오면 롤백
+//                  (보드 위조 불가, 게임 오버도 서버가 판정)
+// ------------------------------
+enum class NetSyncMode : uint8_t
+{
+    Relay = 0,
+    Authoritative,
+};
+
+// ------------------------------
+// Input Batch (권한 모드)
+//  body 순서: [sInputEventWire x count][sInputBatchHeader]
+//  tick 은 클라이언트 엔진 tick (1ms, 게임 시작 = 0). 입력은 그 tick 의 Step 시작 시점에 적용
+//  이벤트 tick = header.tick - tickBack (입력 하나당 3바이트)
+//  서버 → 클라 중계도 같은 형식 (tick 은 서버가 실제로 적용한 tick)
+// ------------------------------
+constexpr uint16_t NET_MAX_INPUTS_PER_BATCH = 64;
+
+struct sInputBatchHeader
+{
+    sNetU32 tick;                   // 이 배치까지 진행한 tick (다음 배치의 입력은 이 tick 이후)
+    uint8_t count = 0;
+    uint8_t wireVersion = NET_WIRE_VERSION;
+};
+
+struct sInputEventWire
+{
+    sNetLE<uint16_t> tickBack;      // header.tick 기준 몇 tick 전
+    uint8_t inputs = 0;             // Tetris::InputFlag 조합
+};
+
+struct sInputCorrection
+{
+    sNetU32 tick;                   // 클라이언트가 보낸 입력 tick
+    sNetU32 appliedTick;            // 서버가 실제로 적용한 tick
+};
+
+static_assert(sizeof(sInputBatchHeader) == 6, "sInputBatchHeader layout");
+static_assert(sizeof(sInputEventWire) == 3, "sInputEventWire layout");
+static_assert(sizeof(sInputCorrection) == 8, "sInputCorrection layout");
+
+// 디코드된 입력 하나
+struct sInputEvent
+{
+    uint64_t tick = 0;
+    uint8_t inputs = 0;
+};
+
+// body 를 소비해 배치를 꺼냄 (events 는 보낸 순서 = 오래된 순). 형식이 틀리면 false
+inline bool ReadInputBatch(sp::net::message<GameMsg>& msg, sInputBatchHeader& header, std::array<sInputEvent, NET_MAX_INPUTS_PER_BATCH>& events)
+{
+    if (msg.body.size() < sizeof(sInputBatchHeader))
+        return false;
+
+    msg >> header;
+
+    if (header.wireVersion != NET_WIRE_VERSION || header.count > NET_MAX_INPUTS_PER_BATCH
+        || msg.body.size() != header.count * sizeof(sInputEventWire))
+        return false;
+
+    // body 뒤에서부터 꺼내므로 마지막 입력이 먼저 나옴
+    const uint64_t tick = header.tick.Get();
+    for (int i = header.count - 1; i >= 0; --i)
+    {
+        sInputEventWire ev;
+        msg >> ev;
+
+        events[i].tick = tick - std::min<uint64_t>(ev.tickBack.Get(), tick);
+        events[i].inputs = ev.inputs;
+    }
+
+    return true;
+}
+
+// ------------------------------
+// Body 읽기
+//  message::operator>> 는 body 크기를 검사하지 않으므로 고정 크기 패킷은 크기부터 확인
+// ------------------------------
+template <typename T>
+inline bool ReadWire(sp::net::message<GameMsg>& msg, T& out)
+{
+    if (msg.body.size() != sizeof(T))
+        return false;
+
+    msg >> out;
+    return true;
+}
+
+// Relay 모드에서 상대에게 그대로 넘기는 패킷의 body 크기 확인 (형식이 틀린 body 는 중계하지 않음)
+inline bool IsRelayBodyValid(const sp::net::message<GameMsg>& msg)
+{
+    const size_t size = msg.body.size();
+
+    switch (msg.header.id)
+    {
+    case GameMsg::Game_CurMinoState:
+    case GameMsg::Game_HoldMinoState:
+        return size == sizeof(sMinoStateWire);
+
+    case GameMsg::Game_PreviewMinoState:
+        return size == sizeof(sPreviewMinoStateWire);
+
+    case GameMsg::Game_BoardState:
+        return size == sizeof(sBoardStateWire);
+
+    case GameMsg::Game_BoardDelta:
+        // 행 개수 / 버전은 수신 측 BoardDeltaDecoder 가 확인
+        return size >= sizeof(sBoardDeltaHeader)
+            && size <= sizeof(sBoardDeltaHeader) + NET_BOARD_HEIGHT * sizeof(sBoardDeltaRow)
+            && (size - sizeof(sBoardDeltaHeader)) % sizeof(sBoardDeltaRow) == 0;
+
+    case GameMsg::Game_BoardResyncRequest:
+        return size == sizeof(sNetU32);
+
+    default:
+        return true;
+    }
+}
+
+#endif // TETRIS_PACKET_PROTOCOL_H
\ No newline at end of file
@@ -5,8 +5,8 @@
 namespace Tetris
 {
     // --------------------------------------------------------------------
-    //  Ʈ ̳ Ÿ (  -  ýۿ  )
-    //  [0..7]  : Ʈũ ȭ ȣȯ
+    //  테트리스 미노 타입 (전역 정의 - 모든 시스템에서 사용 가능)
+    //  [0..7] 값 유지: 네트워크 직렬화와 호환됨
     // --------------------------------------------------------------------
     enum class TetrominoType : int32_t
     {
@@ -21,7 +21,7 @@ namespace Tetris
     };
 
     // --------------------------------------------------------------------
-    //  ȸ  ( )
+    //  회전 정보 (전역 정의)
     // --------------------------------------------------------------------
     enum class Rotation : int32_t
     {
@@ -32,7 +32,7 @@ namespace Tetris
     };
 
     // --------------------------------------------------------------------
-    //    (Է Ŷ 뵵)
+    //  움직임 방향 (입력 패킷 용도)
     // --------------------------------------------------------------------
     enum class MoveDir : int32_t
     {
@@ -42,8 +42,8 @@ namespace Tetris
     };
 
     // --------------------------------------------------------------------
-    //   (TetrominoType  ܼ   ȯ)
-    //  ܼ   Ʈ Color.h °  
+    //  색상 (TetrominoType → 콘솔 출력 색 변환용)
+    //  콘솔 색상 값은 프로젝트의 Color.h에 맞게 변경 가능
     // --------------------------------------------------------------------
     enum ColorCode : int32_t
     {
@@ -64,7 +64,7 @@ namespace Tetris
     };
 
     // --------------------------------------------------------------------
-    //  ̳ /ȸ /̸ / ũ ⺻ 
+    //  미노 개수/회전 개수/미리보기 개수/보드 크기 기본 상수
     // --------------------------------------------------------------------
     constexpr int MINO_COUNT = 4;
     constexpr int ROTATION_COUNT = 4;
@@ -72,7 +72,7 @@ namespace Tetris
     constexpr int MINO_TYPE_COUNT = 7;
 
     // --------------------------------------------------------------------
-    //  TetrominoType   ȯ
+    //  TetrominoType → 색상 변환
     // --------------------------------------------------------------------
     inline int ColorFromType(TetrominoType type)
     {
@@ -90,7 +90,7 @@ namespace Tetris
     }
 
     // --------------------------------------------------------------------
-    //  ȸ  Լ
+    //  회전 헬퍼 함수
     // --------------------------------------------------------------------
     inline Rotation NextCW(Rotation r)
     {
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include <cstdint>
+
+namespace Tetris
+{
+    // --------------------------------------------------------------------
+    //  한 Step 동안 적용할 입력 (비트 플래그, 여러 개 동시 지정 가능)
+    //  적용 순서: HOLD → ROTATE_CW → ROTATE_CCW → LEFT → RIGHT → SOFT_DROP → HARD_DROP
+    // --------------------------------------------------------------------
+    enum InputFlag : uint8_t
+    {
+        INPUT_NONE       = 0,
+        INPUT_LEFT       = 1 << 0,
+        INPUT_RIGHT      = 1 << 1,
+        INPUT_SOFT_DROP  = 1 << 2,
+        INPUT_HARD_DROP  = 1 << 3,
+        INPUT_ROTATE_CW  = 1 << 4,
+        INPUT_ROTATE_CCW = 1 << 5,
+        INPUT_HOLD       = 1 << 6,
+    };
+
+    // --------------------------------------------------------------------
+    //  엔진이 발생시키는 이벤트 (사운드/연출/네트워크 동기화는 어댑터가 처리)
+    // --------------------------------------------------------------------
+    enum class EngineEventType : uint8_t
+    {
+        Spawn,      // 새 미노 스폰
+        Move,       // 입력에 의한 좌우 이동 성공 (value: dx)
+        Rotate,     // 회전 성공 (value: +1 CW, -1 CCW)
+        SoftDrop,   // 소프트 드롭 성공 (value: 1)
+        HardDrop,   // 하드 드롭 (value: 낙하한 칸 수)
+        Hold,       // 홀드 성공
+        Lock,       // 보드에 고정
+        LineClear,  // 라인 클리어 (value: 제거된 줄 수)
+        Combo,      // 콤보 발생 (value: 콤보 수)
+        TopOut      // 스폰 불가 → 게임 오버
+    };
+
+    struct sEngineEvent
+    {
+        EngineEventType type{};
+        int32_t value{ 0 };
+        uint64_t tick{ 0 };     // 이벤트가 발생한 엔진 tick
+    };
+
+    // 엔진 1 tick = 1ms (기존 Timer 기반 중력 간격과 동일한 단위)
+    constexpr uint32_t ENGINE_TICKS_PER_SECOND = 1000;
+
+} // namespace Tetris
@@ -0,0 +1,314 @@
+﻿#include "GameEngine.h"
+#include "../TetrominoTable.h"
+#include <algorithm>
+
+using namespace Tetris;
+
+GameEngine::GameEngine(uint64_t seed)
+{
+	// 한 Step 에서 발생 가능한 이벤트 수보다 넉넉하게 잡아 재할당 방지
+	m_Events.reserve(32);
+
+	Reset(seed);
+}
+
+GameEngine::~GameEngine() = default;
+
+void GameEngine::Reset(uint64_t seed)
+{
+	m_Board.Clear();
+	m_Bag.Seed(seed);
+	m_Score.Reset();
+
+	m_bHasCurMino = false;
+	m_bGhostDirty = true;
+	m_HoldType = TetrominoType::None;
+	m_bHasHeldThisTurn = false;
+	m_LastCleared = {};
+
+	m_Tick = 0;
+	m_GravityTicks = 0;
+	m_TotalPieces = 0;
+	m_bGameOver = false;
+
+	m_Events.clear();
+
+	TrySpawnMino();
+	UpdateGhost();
+}
+
+void GameEngine::Step(uint8_t inputs, uint32_t ticks)
+{
+	if (m_bGameOver)
+		return;
+
+	ApplyInputs(inputs);
+	AdvanceGravity(ticks);
+
+	m_Tick += ticks;
+
+	UpdateGhost();
+}
+
+const uint32_t GameEngine::GravityIntervalTicks() const
+{
+	// 레벨에 따라 가속 (ex. 700ms에서 레벨당 50ms 감소, 최소 80ms)
+	const int level = std::max(1, m_Score.GetLevel());
+	const int base = 700;
+	const int step = 50;
+	const int ms = base - (level - 1) * step;
+
+	return static_cast<uint32_t>(std::max(80, ms));
+}
+
+void GameEngine::ApplyInputs(uint8_t inputs)
+{
+	if (inputs == INPUT_NONE)
+		return;
+
+	if (inputs & INPUT_HOLD)
+		TryHold();
+
+	if (inputs & INPUT_ROTATE_CW)
+		TryRotate(true);
+
+	if (inputs & INPUT_ROTATE_CCW)
+		TryRotate(false);
+
+	if (inputs & INPUT_LEFT)
+		TryMove(-1);
+
+	if (inputs & INPUT_RIGHT)
+		TryMove(+1);
+
+	if (inputs & INPUT_SOFT_DROP)
+		TrySoftDrop();
+
+	if (inputs & INPUT_HARD_DROP)
+		HardDrop();
+}
+
+void GameEngine::AdvanceGravity(uint32_t ticks)
+{
+	m_GravityTicks += ticks;
+
+	// ticks 가 중력 간격보다 크면 (시뮬레이션 등) 여러 칸을 한 번에 진행
+	while (!m_bGameOver)
+	{
+		const uint32_t interval = GravityIntervalTicks();
+		if (m_GravityTicks < interval)
+			break;
+
+		m_GravityTicks -= interval;
+
+		if (!Shift(0, +1))
+		{
+			// 고정 이후 남은 tick 은 새 미노 몫으로 유지
+			// → Step 을 몇 번에 나눠 호출해도 같은 tick 에 같은 결과 (서버 재시뮬레이션 / 리플레이)
+			const uint32_t carried = m_GravityTicks;
+			LockAndProceed();
+			m_GravityTicks = carried;
+		}
+	}
+}
+
+bool GameEngine::TrySpawnMino()
+{
+	// 다음 미노 스폰시 충돌 발생하는지 검사
+	Tetromino tempMino(m_Bag.Peek(0));
+	tempMino.SetPos(TetrominoTable::SPAWN_POS.x, TetrominoTable::SPAWN_POS.y);
+
+	if (m_Board.IsCollide(tempMino, 0, 0))
+	{
+		m_bHasCurMino = false;
+		m_bGameOver = true;
+		PushEvent(EngineEventType::TopOut);
+		return false;
+	}
+
+	// 중앙 상단 스폰
+	m_CurMino = Tetromino(m_Bag.Next());
+	m_CurMino.SetRotation(Rotation::R0);
+	m_CurMino.SetPos(TetrominoTable::SPAWN_POS.x, TetrominoTable::SPAWN_POS.y);
+	m_bHasCurMino = true;
+
+	m_GravityTicks = 0;
+	m_bGhostDirty = true;
+
+	UpdatePreview();
+	PushEvent(EngineEventType::Spawn, static_cast<int32_t>(m_CurMino.GetType()));
+
+	return true;
+}
+
+bool GameEngine::Shift(int dx, int dy)
+{
+	if (!m_bHasCurMino)
+		return false;
+
+	if (m_Board.IsCollide(m_CurMino, dx, dy))
+		return false;
+
+	m_CurMino.SetPos(m_CurMino.GetX() + dx, m_CurMino.GetY() + dy);
+	m_bGhostDirty = true;
+
+	return true;
+}
+
+bool GameEngine::TryMove(int dx)
+{
+	if (!Shift(dx, 0))
+		return false;
+
+	PushEvent(EngineEventType::Move, dx);
+	return true;
+}
+
+bool GameEngine::TryRotate(bool bClockwise)
+{
+	if (!m_bHasCurMino)
+		return false;
+
+	const Rotation prevRot = m_CurMino.GetRotation();
+	if (bClockwise)
+		m_CurMino.RotateCW();
+	else
+		m_CurMino.RotateCCW();
+
+	if (m_Board.IsCollide(m_CurMino, 0, 0))
+	{
+		m_CurMino.SetRotation(prevRot);
+		return false;
+	}
+
+	m_bGhostDirty = true;
+	PushEvent(EngineEventType::Rotate, bClockwise ? +1 : -1);
+	return true;
+}
+
+bool GameEngine::TryHold()
+{
+	// 한 턴에 한번씩만 홀드 가능
+	if (m_bHasHeldThisTurn || !m_bHasCurMino)
+		return false;
+
+	if (m_HoldType == TetrominoType::None)
+	{
+		// 현재 미노타입을 홀드 타입으로 대입
+		m_HoldType = m_CurMino.GetType();
+
+		if (!TrySpawnMino())
+			return false;
+	}
+	else
+	{
+		// 홀드 미노와 스왑시 충돌 발생하는지 검사
+		Tetromino tempMino(m_HoldType);
+		tempMino.SetPos(TetrominoTable::SPAWN_POS.x, TetrominoTable::SPAWN_POS.y);
+
+		if (m_Board.IsCollide(tempMino, 0, 0))
+			return false;
+
+		const TetrominoType oldMinoType = m_CurMino.GetType();
+
+		// 현재 미노를 홀드 타입으로 교체 및 초기화
+		m_CurMino.SetType(m_HoldType);
+		m_CurMino.SetRotation(Rotation::R0);
+		m_CurMino.SetPos(TetrominoTable::SPAWN_POS.x, TetrominoTable::SPAWN_POS.y);
+
+		m_HoldType = oldMinoType;
+		m_GravityTicks = 0;
+		m_bGhostDirty = true;
+	}
+
+	// 고정되기 전까지 재홀드 불가
+	m_bHasHeldThisTurn = true;
+	PushEvent(EngineEventType::Hold, static_cast<int32_t>(m_HoldType));
+	return true;
+}
+
+bool GameEngine::TrySoftDrop()
+{
+	if (!Shift(0, +1))
+		return false;
+
+	m_Score.AddSoftDrop(1);
+	m_GravityTicks = 0;
+
+	PushEvent(EngineEventType::SoftDrop, 1);
+	return true;
+}
+
+void GameEngine::HardDrop()
+{
+	if (!m_bHasCurMino)
+		return;
+
+	// 열 높이 캐시로 낙하 거리 계산
+	const int dropped = m_Board.DropDistance(m_CurMino);
+
+	if (dropped > 0)
+	{
+		m_CurMino.SetPos(m_CurMino.GetX(), m_CurMino.GetY() + dropped);
+		m_Score.AddHardDrop(dropped);
+	}
+
+	PushEvent(EngineEventType::HardDrop, dropped);
+	LockAndProceed();
+}
+
+void GameEngine::LockAndProceed()
+{
+	if (!m_bHasCurMino)
+		return;
+
+	// 누적 피스갯수 증가
+	m_TotalPieces++;
+
+	// 보드에 고정
+	m_Board.Lock(m_CurMino);
+	m_bHasCurMino = false;
+	PushEvent(EngineEventType::Lock, static_cast<int32_t>(m_CurMino.GetType()));
+
+	// 라인 클리어
+	const int cleared = m_Board.ClearFullLines(m_LastCleared);
+
+	// 점수 기록 (T-Spin 판정은 지원하지 않음)
+	const bool isTSpin = false;
+	m_Score.OnLinesCleared(cleared, isTSpin);
+
+	// 이번 턴에 콤보 발생하였음
+	if (cleared > 0)
+	{
+		PushEvent(EngineEventType::LineClear, cleared);
+		PushEvent(EngineEventType::Combo, m_Score.GetCombo());
+	}
+
+	// 새 턴 시작되므로 홀드 제한 해제
+	m_bHasHeldThisTurn = false;
+
+	// 새 미노 스폰
+	TrySpawnMino();
+}
+
+void GameEngine::UpdatePreview()
+{
+	for (int i = 0; i < Tetris::MINO_PREVIEW_COUNT; ++i)
+		m_Preview[i] = m_Bag.Peek(static_cast<size_t>(i));
+}
+
+void GameEngine::UpdateGhost()
+{
+	// 미노가 움직이거나 보드가 바뀐 경우에만 재계산
+	if (!m_bHasCurMino || !m_bGhostDirty)
+		return;
+
+	m_GhostMino = m_CurMino;
+	m_GhostMino.SetPos(m_GhostMino.GetX(), m_GhostMino.GetY() + m_Board.DropDistance(m_GhostMino));
+	m_bGhostDirty = false;
+}
+
+void GameEngine::PushEvent(EngineEventType type, int32_t value)
+{
+	m_Events.push_back({ type, value, m_Tick });
+}
@@ -0,0 +1,98 @@
+﻿#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include "EngineTypes.h"
+#include "../common/TetrisTypes.h"
+#include "../Board.h"
+#include "../BagRandom.h"
+#include "../Score.h"
+#include "../Tetromino.h"
+
+// --------------------------------------------------------------------
+//  Console / SoundManager / Timer 에 의존하지 않는 테트리스 규칙 엔진
+//  Step(inputs, ticks) 로만 진행되므로 같은 시드와 입력이면 항상 같은 결과
+//  입력이 적용된 tick 만 같으면 Step 을 어떻게 나눠 호출했는지와 무관 (서버 권한 모드에서 재현에 사용)
+// --------------------------------------------------------------------
+class GameEngine
+{
+public:
+	explicit GameEngine(uint64_t seed = 0);
+	~GameEngine();
+
+	// 스냅샷 (롤백): 상태 전체 복사. 보드 / 가방이 고정 크기라 할당 없음
+	GameEngine(const GameEngine&) = default;
+	GameEngine& operator=(const GameEngine&) = default;
+
+	// 시드로 초기화 후 첫 미노 스폰 (seed 0: 시간 기반 랜덤)
+	void Reset(uint64_t seed);
+
+	// 입력을 적용한 뒤 ticks 만큼 중력 진행
+	void Step(uint8_t inputs, uint32_t ticks);
+
+	// --- 상태 ---
+	const bool IsGameOver() const { return m_bGameOver; }
+	const uint64_t GetTick() const { return m_Tick; }
+
+	const Board& GetBoard() const { return m_Board; }
+	const Tetromino* GetCurMino() const { return m_bHasCurMino ? &m_CurMino : nullptr; }
+	const Tetromino* GetGhostMino() const { return m_bHasCurMino ? &m_GhostMino : nullptr; }
+	const Tetris::TetrominoType GetHoldType() const { return m_HoldType; }
+	const bool CanHold() const { return !m_bHasHeldThisTurn; }
+	const std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT>& GetPreview() const { return m_Preview; }
+	const sClearedLines& GetLastCleared() const { return m_LastCleared; }
+
+	const Score& GetScore() const { return m_Score; }
+	const int GetTotalPieces() const { return m_TotalPieces; }
+
+	const uint32_t GravityIntervalTicks() const;
+
+	// --- 이벤트 (어댑터가 소비 후 비움) ---
+	const std::vector<Tetris::sEngineEvent>& GetEvents() const { return m_Events; }
+	void ClearEvents() { m_Events.clear(); }
+
+private:
+	void ApplyInputs(uint8_t inputs);
+	void AdvanceGravity(uint32_t ticks);
+
+	// 게임 로직
+	bool TrySpawnMino();
+	bool Shift(int dx, int dy);
+	bool TryMove(int dx);
+	bool TryRotate(bool bClockwise);
+	bool TryHold();
+	bool TrySoftDrop();
+	void HardDrop();
+	void LockAndProceed();
+
+	void UpdatePreview();
+	void UpdateGhost();
+
+	void PushEvent(Tetris::EngineEventType type, int32_t value = 0);
+
+private:
+	Board m_Board;
+	BagRandom m_Bag;
+	Score m_Score;
+
+	Tetromino m_CurMino;
+	Tetromino m_GhostMino;
+	bool m_bHasCurMino{ false };
+	bool m_bGhostDirty{ true };
+
+	std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT> m_Preview{};
+
+	Tetris::TetrominoType m_HoldType{ Tetris::TetrominoType::None };
+	bool m_bHasHeldThisTurn{ false };
+
+	sClearedLines m_LastCleared{};
+
+	uint64_t m_Tick{ 0 };
+	uint32_t m_GravityTicks{ 0 };
+
+	int m_TotalPieces{ 0 };
+	bool m_bGameOver{ false };
+
+	std::vector<Tetris::sEngineEvent> m_Events;
+};
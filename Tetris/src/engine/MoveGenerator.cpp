@@ -0,0 +1,224 @@
+﻿#include "MoveGenerator.h"
+#include "../Board.h"
+#include "../TetrominoTable.h"
+#include <algorithm>
+
+using namespace Tetris;
+
+namespace
+{
+	struct sMove
+	{
+		uint8_t input;
+		int dx, dy, drot;
+	};
+
+	// BFS 확장 순서 (같은 깊이면 앞쪽 입력이 먼저 선택됨)
+	constexpr std::array<sMove, 5> MOVES{ {
+		{ INPUT_LEFT,       -1, 0,  0 },
+		{ INPUT_RIGHT,      +1, 0,  0 },
+		{ INPUT_ROTATE_CW,   0, 0, +1 },
+		{ INPUT_ROTATE_CCW,  0, 0, -1 },
+		{ INPUT_SOFT_DROP,   0, 1,  0 },
+	} };
+
+	// 점유 칸으로 만든 키 (회전이 달라도 같은 칸이면 같은 키)
+	uint64_t PlacementKey(TetrominoType type, int rot, int x, int y)
+	{
+		const sPieceInfo& info = TetrominoTable::Get(type, static_cast<Rotation>(rot));
+
+		uint64_t masks = 0;
+		for (int r = 0; r < info.height; ++r)
+			masks |= static_cast<uint64_t>(info.rowMasks[static_cast<size_t>(r)]) << (r * 4);
+
+		const uint64_t left = static_cast<uint64_t>(x + info.minX);
+		const uint64_t top = static_cast<uint64_t>(y + info.minY);
+
+		return (top << 24) | (left << 16) | masks;
+	}
+}
+
+sPiecePose MoveGenerator::GetSpawnPose()
+{
+	return { TetrominoTable::SPAWN_POS.x, TetrominoTable::SPAWN_POS.y, Rotation::R0 };
+}
+
+int MoveGenerator::Generate(const Board& board, TetrominoType type, std::vector<sPlacement>& out, bool bUseHold)
+{
+	return GenerateFrom(board, type, GetSpawnPose(), out, bUseHold);
+}
+
+int MoveGenerator::GenerateFrom(const Board& board, TetrominoType type, const sPiecePose& start, std::vector<sPlacement>& out, bool bUseHold)
+{
+	if (type == TetrominoType::None)
+		return 0;
+
+	BuildFitMap(board, type);
+
+	for (auto& row : m_Visited)
+		row.fill(0);
+	m_Keys.clear();
+
+	const int startRot = static_cast<int>(start.rot);
+
+	// 시작 자세에 놓을 수 없음 (스폰이면 탑아웃)
+	if (!IsFree(start.x, start.y, startRot))
+		return 0;
+
+	const int startCount = static_cast<int>(out.size());
+
+	uint16_t head = 0;
+	uint16_t tail = 0;
+
+	TryVisit(start.x, start.y, startRot);
+	m_Nodes[tail++] = { static_cast<int8_t>(start.x), static_cast<int8_t>(start.y), static_cast<uint8_t>(startRot), INPUT_NONE, 0, 0 };
+
+	while (head < tail)
+	{
+		const uint16_t cur = head++;
+		const sNode node = m_Nodes[cur];
+
+		// 더 내려갈 수 없으면 최종 배치
+		if (!IsFree(node.x, node.y + 1, node.rot))
+		{
+			const uint64_t key = PlacementKey(type, node.rot, node.x, node.y);
+			if (std::find(m_Keys.begin(), m_Keys.end(), key) == m_Keys.end())
+			{
+				sPlacement placement;
+				placement.type = type;
+				placement.rot = static_cast<Rotation>(node.rot);
+				placement.x = node.x;
+				placement.y = node.y;
+				placement.bUseHold = bUseHold;
+
+				if (BuildPath(cur, bUseHold, placement))
+				{
+					m_Keys.push_back(key);
+					out.push_back(placement);
+				}
+			}
+		}
+
+		for (const auto& move : MOVES)
+		{
+			const int nrot = (node.rot + move.drot + Tetris::ROTATION_COUNT) % Tetris::ROTATION_COUNT;
+			const int nx = node.x + move.dx;
+			const int ny = node.y + move.dy;
+
+			if (!IsFree(nx, ny, nrot) || !TryVisit(nx, ny, nrot))
+				continue;
+
+			m_Nodes[tail++] = { static_cast<int8_t>(nx), static_cast<int8_t>(ny), static_cast<uint8_t>(nrot), move.input, cur,
+				static_cast<uint16_t>(node.depth + 1) };
+		}
+	}
+
+	return static_cast<int>(out.size()) - startCount;
+}
+
+int MoveGenerator::GenerateWithHold(const Board& board, TetrominoType curType, const sPiecePose& curPose, TetrominoType holdType,
+	TetrominoType nextType, bool bCanHold, std::vector<sPlacement>& out)
+{
+	int count = GenerateFrom(board, curType, curPose, out, false);
+
+	if (!bCanHold)
+		return count;
+
+	// 홀드가 비어 있으면 다음 미노가 스폰됨
+	const TetrominoType swapped = (holdType == TetrominoType::None) ? nextType : holdType;
+	if (swapped != curType)
+		count += Generate(board, swapped, out, true);
+
+	return count;
+}
+
+void MoveGenerator::BuildFitMap(const Board& board, TetrominoType type)
+{
+	const int width = board.GetWidth();
+	const int height = board.GetHeight();
+
+	for (int rot = 0; rot < Tetris::ROTATION_COUNT; ++rot)
+	{
+		const sPieceInfo& info = TetrominoTable::Get(type, static_cast<Rotation>(rot));
+		auto& fit = m_Fit[static_cast<size_t>(rot)];
+		fit.fill(0);
+
+		// Board::IsCollide 와 같은 판정을 피벗 (x, y) 전체에 대해 한 번에 계산
+		for (int y = 0; y < MAX_Y; ++y)
+		{
+			const int top = y + info.minY;
+			if (top < 0 || top + info.height > height)
+				continue;
+
+			uint16_t mask = 0;
+			for (int left = 0; left + info.width <= width; ++left)
+			{
+				bool bCollide = false;
+				for (int r = 0; r < info.height && !bCollide; ++r)
+					bCollide = (board.GetRow(top + r) & (info.rowMasks[static_cast<size_t>(r)] << left)) != 0;
+
+				const int bit = left - info.minX + X_OFFSET;
+				if (!bCollide && bit >= 0 && bit < 16)
+					mask |= static_cast<uint16_t>(1u << bit);
+			}
+
+			fit[static_cast<size_t>(y)] = mask;
+		}
+	}
+}
+
+bool MoveGenerator::IsFree(int x, int y, int rot) const
+{
+	const int bit = x + X_OFFSET;
+	if (bit < 0 || bit >= 16 || y < 0 || y >= MAX_Y)
+		return false;
+
+	return (m_Fit[static_cast<size_t>(rot)][static_cast<size_t>(y)] >> bit) & 1u;
+}
+
+bool MoveGenerator::TryVisit(int x, int y, int rot)
+{
+	const int bit = x + X_OFFSET;
+	if (bit < 0 || bit >= 16 || y < 0 || y >= MAX_Y)
+		return false;
+
+	uint16_t& mask = m_Visited[static_cast<size_t>(rot)][static_cast<size_t>(y)];
+	const uint16_t flag = static_cast<uint16_t>(1u << bit);
+
+	if (mask & flag)
+		return false;
+
+	mask |= flag;
+	return true;
+}
+
+bool MoveGenerator::BuildPath(uint16_t nodeIndex, bool bUseHold, sPlacement& out) const
+{
+	// 부모를 따라가며 역순으로 수집
+	std::array<uint8_t, MAX_NODES> reversed;
+	int length = 0;
+
+	for (uint16_t i = nodeIndex; i != 0; i = m_Nodes[i].parent)
+		reversed[static_cast<size_t>(length++)] = m_Nodes[i].input;
+
+	// 끝의 연속된 소프트 드롭은 하드 드롭 한 번과 같은 위치에 도달
+	int begin = 0;
+	while (begin < length && reversed[static_cast<size_t>(begin)] == INPUT_SOFT_DROP)
+		++begin;
+
+	const int total = (bUseHold ? 1 : 0) + (length - begin) + 1;
+	if (total > sPlacement::MAX_PATH)
+		return false;
+
+	int n = 0;
+	if (bUseHold)
+		out.path[static_cast<size_t>(n++)] = INPUT_HOLD;
+
+	for (int i = length - 1; i >= begin; --i)
+		out.path[static_cast<size_t>(n++)] = reversed[static_cast<size_t>(i)];
+
+	out.path[static_cast<size_t>(n++)] = INPUT_HARD_DROP;
+	out.pathLength = static_cast<uint8_t>(n);
+
+	return true;
+}
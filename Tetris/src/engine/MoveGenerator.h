@@ -0,0 +1,99 @@
+﻿#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "EngineTypes.h"
+#include "../utils/Types.h"
+#include "../common/TetrisTypes.h"
+
+class Board;
+
+// --------------------------------------------------------------------
+//  하나의 최종 배치 (고정 직전 위치) 와 그 위치까지의 입력 경로
+// --------------------------------------------------------------------
+struct sPlacement
+{
+	static constexpr int MAX_PATH = 48;
+
+	Tetris::TetrominoType type{ Tetris::TetrominoType::None };
+	Tetris::Rotation rot{ Tetris::Rotation::R0 };
+	int x{ 0 }, y{ 0 };				// 피벗 좌표
+
+	bool bUseHold{ false };			// 경로 첫 입력이 INPUT_HOLD
+
+	// Step 한 번에 하나씩 적용할 Tetris::InputFlag (마지막은 항상 INPUT_HARD_DROP)
+	uint8_t pathLength{ 0 };
+	std::array<uint8_t, MAX_PATH> path{};
+};
+
+// 미노 자세 (피벗 좌표 + 회전)
+struct sPiecePose
+{
+	int x{ 0 }, y{ 0 };
+	Tetris::Rotation rot{ Tetris::Rotation::R0 };
+};
+
+// --------------------------------------------------------------------
+//  스폰 위치 (또는 지정한 자세) 에서 합법적인 입력(좌/우/회전/소프트 드롭)만으로 도달 가능한
+//  모든 최종 배치를 BFS 로 열거
+//
+//  - 충돌 판정은 Board::IsCollide 와 동일 (벽킥 없음). 회전별로 피벗이 들어갈 수
+//    있는 위치를 행 마스크에서 미리 계산해 두고 BFS 에서는 비트 검사만 수행
+//  - 스폰 위치는 GameEngine 과 동일 (BOARD_WIDTH / 2, 1), R0
+//  - 방문 여부는 (회전, y) 별 16비트 x 마스크로 관리 (256 바이트)
+//  - 같은 칸을 차지하는 배치(O 회전, I/S/Z 180도 등)는 하나로 합침
+//
+//  인스턴스 내부 버퍼를 재사용하므로 스레드마다 하나씩 사용
+// --------------------------------------------------------------------
+class MoveGenerator
+{
+public:
+	MoveGenerator() = default;
+
+	// GameEngine 스폰 자세
+	static sPiecePose GetSpawnPose();
+
+	// type 미노의 배치를 out 에 추가하고 추가한 개수 반환
+	int Generate(const Board& board, Tetris::TetrominoType type, std::vector<sPlacement>& out, bool bUseHold = false);
+
+	// start 자세에서 시작 (중력으로 이미 내려온 미노 재탐색), 경로도 start 기준
+	int GenerateFrom(const Board& board, Tetris::TetrominoType type, const sPiecePose& start, std::vector<sPlacement>& out, bool bUseHold = false);
+
+	// 현재 미노 (curPose 에서) + (홀드 가능하면) 홀드로 얻는 미노 (스폰에서) 의 배치를 모두 생성
+	// holdType 이 None 이면 홀드 시 nextType 이 스폰됨
+	int GenerateWithHold(const Board& board, Tetris::TetrominoType curType, const sPiecePose& curPose, Tetris::TetrominoType holdType,
+		Tetris::TetrominoType nextType, bool bCanHold, std::vector<sPlacement>& out);
+
+private:
+	struct sNode
+	{
+		int8_t x{ 0 }, y{ 0 };
+		uint8_t rot{ 0 };
+		uint8_t input{ 0 };			// 부모에서 이 노드로 올 때의 입력
+		uint16_t parent{ 0 };
+		uint16_t depth{ 0 };
+	};
+
+	// 방문 마스크 인덱싱 (피벗 x 는 음수가 될 수 있으므로 오프셋 적용)
+	static constexpr int X_OFFSET = 4;
+	static constexpr int MAX_Y = 32;
+	static_assert(BOARD_HEIGHT <= MAX_Y, "visited/fit masks hold MAX_Y rows");
+	static constexpr int MAX_NODES = Tetris::ROTATION_COUNT * MAX_Y * 16;
+
+	// 회전/y 별로 미노가 충돌 없이 놓일 수 있는 피벗 x 마스크 계산
+	void BuildFitMap(const Board& board, Tetris::TetrominoType type);
+	bool IsFree(int x, int y, int rot) const;
+
+	bool TryVisit(int x, int y, int rot);
+	// 경로가 MAX_PATH 를 넘으면 false
+	bool BuildPath(uint16_t nodeIndex, bool bUseHold, sPlacement& out) const;
+
+private:
+	std::array<std::array<uint16_t, MAX_Y>, Tetris::ROTATION_COUNT> m_Fit{};
+	std::array<std::array<uint16_t, MAX_Y>, Tetris::ROTATION_COUNT> m_Visited{};
+	std::array<sNode, MAX_NODES> m_Nodes{};
+
+	// 배치 중복 제거용 점유 칸 키
+	std::vector<uint64_t> m_Keys;
+};
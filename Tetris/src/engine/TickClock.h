@@ -0,0 +1,41 @@
+﻿#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+// 엔진에 전달할 tick 을 얻기 위한 시계 (1 tick = 1ms)
+class ITickClock
+{
+public:
+	virtual ~ITickClock() = default;
+
+	virtual uint64_t Now() const = 0;
+};
+
+// 실제 시간 기반 (게임 화면용)
+class SteadyTickClock final : public ITickClock
+{
+public:
+	SteadyTickClock() : m_StartPoint{ std::chrono::steady_clock::now() } {}
+
+	uint64_t Now() const override
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_StartPoint).count());
+	}
+
+private:
+	std::chrono::steady_clock::time_point m_StartPoint;
+};
+
+// 수동 진행 (시뮬레이션/테스트/리플레이용, 실제 시간보다 빠르게 진행 가능)
+class ManualTickClock final : public ITickClock
+{
+public:
+	uint64_t Now() const override { return m_Now; }
+
+	void Advance(uint64_t ticks) { m_Now += ticks; }
+	void Set(uint64_t now) { m_Now = now; }
+
+private:
+	uint64_t m_Now{ 0 };
+};
@@ -0,0 +1,148 @@
+﻿#include "BoardSync.h"
+#include "../Board.h"
+#include <algorithm>
+
+namespace
+{
+    void PackRow(const uint8_t* cells, sBoardDeltaRow& row)
+    {
+        row.cells.fill(0);
+        for (int x = 0; x < NET_BOARD_WIDTH; ++x)
+            row.cells[x / 2] |= static_cast<uint8_t>((cells[x] & 0x0f) << ((x & 1) * 4));
+    }
+
+    void UnpackRow(const sBoardDeltaRow& row, int* cells)
+    {
+        for (int x = 0; x < NET_BOARD_WIDTH; ++x)
+            cells[x] = (row.cells[x / 2] >> ((x & 1) * 4)) & 0x0f;
+    }
+
+    // rows (제거 전 기준, 아래 → 위) 를 지우고 위 행들을 아래로 당김
+    template <typename Cell>
+    void RemoveRows(Cell* cells, const uint8_t* rows, int count)
+    {
+        int write = NET_BOARD_HEIGHT - 1;
+        int next = 0;
+
+        for (int read = NET_BOARD_HEIGHT - 1; read >= 0; --read)
+        {
+            if (next < count && rows[next] == read)
+            {
+                ++next;
+                continue;
+            }
+
+            if (write != read)
+                std::copy_n(cells + read * NET_BOARD_WIDTH, NET_BOARD_WIDTH, cells + write * NET_BOARD_WIDTH);
+            --write;
+        }
+
+        for (; write >= 0; --write)
+            std::fill_n(cells + write * NET_BOARD_WIDTH, NET_BOARD_WIDTH, Cell{ 0 });
+    }
+}
+
+void BoardDeltaEncoder::Encode(const Board& board, const sClearedLines* cleared, sp::net::message<GameMsg>& out)
+{
+    // 빈 행은 행 마스크만 보고 건너뜀
+    std::array<uint8_t, NET_BOARD_CELLS> current{};
+    for (int y = 0; y < NET_BOARD_HEIGHT; ++y)
+    {
+        if (board.GetRow(y) == 0)
+            continue;
+
+        for (int x = 0; x < NET_BOARD_WIDTH; ++x)
+            current[y * NET_BOARD_WIDTH + x] = static_cast<uint8_t>(board.Get(x, y));
+    }
+
+    sBoardDeltaHeader header;
+    header.baseVersion.Set(m_Version);
+    header.version.Set(++m_Version);
+
+    const bool bKeyframe = m_bForceKeyframe || !cleared || (m_Version % KEYFRAME_INTERVAL) == 0;
+
+    if (bKeyframe)
+    {
+        header.flags = NET_BOARD_DELTA_KEYFRAME;
+        m_Sent.fill(0);
+        m_bForceKeyframe = false;
+    }
+    else if (cleared->count > 0)
+    {
+        header.clearedCount = static_cast<uint8_t>(std::min<int>(cleared->count, NET_BOARD_MAX_CLEARED));
+        for (int i = 0; i < header.clearedCount; ++i)
+            header.clearedRows[i] = static_cast<uint8_t>(cleared->rows[i]);
+
+        // 수신 측과 같은 순서로 줄 제거를 먼저 반영한 뒤 비교
+        RemoveRows(m_Sent.data(), header.clearedRows.data(), header.clearedCount);
+    }
+
+    out.header.id = GameMsg::Game_BoardDelta;
+    out.body.reserve(out.body.size() + sizeof(sBoardDeltaHeader) + NET_BOARD_HEIGHT * sizeof(sBoardDeltaRow));
+
+    for (int y = 0; y < NET_BOARD_HEIGHT; ++y)
+    {
+        const uint8_t* sentRow = m_Sent.data() + y * NET_BOARD_WIDTH;
+        const uint8_t* curRow = current.data() + y * NET_BOARD_WIDTH;
+        if (std::equal(curRow, curRow + NET_BOARD_WIDTH, sentRow))
+            continue;
+
+        sBoardDeltaRow row;
+        row.y = static_cast<uint8_t>(y);
+        PackRow(curRow, row);
+
+        out << row;
+        ++header.rowCount;
+    }
+
+    out << header;
+    m_Sent = current;
+}
+
+BoardDeltaDecoder::Result BoardDeltaDecoder::Apply(sp::net::message<GameMsg>& msg)
+{
+    if (msg.body.size() < sizeof(sBoardDeltaHeader))
+        return Result::Malformed;
+
+    sBoardDeltaHeader header;
+    msg >> header;
+
+    if (header.wireVersion != NET_WIRE_VERSION || header.clearedCount > NET_BOARD_MAX_CLEARED
+        || msg.body.size() != header.rowCount * sizeof(sBoardDeltaRow))
+    {
+        m_bAwaitingKeyframe = true;
+        return Result::Malformed;
+    }
+
+    const bool bKeyframe = (header.flags & NET_BOARD_DELTA_KEYFRAME) != 0;
+
+    if (!bKeyframe && (m_bAwaitingKeyframe || header.baseVersion.Get() != m_Version))
+    {
+        m_bAwaitingKeyframe = true;
+        return Result::Gap;
+    }
+
+    if (bKeyframe)
+        m_State.cells.fill(0);
+    else if (header.clearedCount > 0)
+        RemoveRows(m_State.cells.data(), header.clearedRows.data(), header.clearedCount);
+
+    for (int i = 0; i < header.rowCount; ++i)
+    {
+        sBoardDeltaRow row;
+        msg >> row;
+
+        // 이미 일부 행을 덮어썼으므로 키프레임으로 복구
+        if (row.y >= NET_BOARD_HEIGHT)
+        {
+            m_bAwaitingKeyframe = true;
+            return Result::Malformed;
+        }
+
+        UnpackRow(row, m_State.cells.data() + row.y * NET_BOARD_WIDTH);
+    }
+
+    m_Version = header.version.Get();
+    m_bAwaitingKeyframe = false;
+    return Result::Applied;
+}
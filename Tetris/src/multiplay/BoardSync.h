@@ -0,0 +1,65 @@
+﻿#pragma once
+
+#include "../common/PacketProtocol.h"
+#include <array>
+#include <cstdint>
+
+class Board;
+struct sClearedLines;
+
+// --------------------------------------------------------------------
+//  Local 보드 → Game_BoardDelta 메시지
+//
+//  마지막으로 보낸 보드(m_Sent)와 비교해 바뀐 행만 4비트/칸으로 담는다.
+//  직전 고정에서 지운 줄은 행 인덱스로 따로 보내 수신 측이 직접 당기게 하므로
+//  라인 클리어가 있어도 새 미노가 걸친 행 정도만 전송된다.
+//  KEYFRAME_INTERVAL 버전마다, 또는 RequestKeyframe 이후에는 전체 보드를 보냄
+// --------------------------------------------------------------------
+class BoardDeltaEncoder
+{
+public:
+    static constexpr uint32_t KEYFRAME_INTERVAL = 30;
+
+    // 다음 Encode 를 키프레임으로 (상대의 재동기화 요청 시)
+    void RequestKeyframe() { m_bForceKeyframe = true; }
+
+    // cleared: 마지막 Encode 이후 고정이 정확히 한 번 있었을 때 그 라인 클리어 결과
+    //          (nullptr 이면 줄 이동을 표현할 수 없으므로 키프레임)
+    void Encode(const Board& board, const sClearedLines* cleared, sp::net::message<GameMsg>& out);
+
+    const uint32_t GetVersion() const { return m_Version; }
+
+private:
+    uint32_t m_Version{ 0 };
+    bool m_bForceKeyframe{ true };
+
+    std::array<uint8_t, NET_BOARD_CELLS> m_Sent{};
+};
+
+// --------------------------------------------------------------------
+//  Game_BoardDelta 메시지 → Remote 보드 상태
+// --------------------------------------------------------------------
+class BoardDeltaDecoder
+{
+public:
+    enum class Result
+    {
+        Applied,
+        Gap,            // 기준 버전이 다름 → 키프레임 필요 (적용 안 함)
+        Malformed,      // 크기/행 인덱스 오류 → 키프레임 필요
+    };
+
+    Result Apply(sp::net::message<GameMsg>& msg);
+
+    const sBoardState& GetState() const { return m_State; }
+    const uint32_t GetVersion() const { return m_Version; }
+
+    // Gap 이후 키프레임을 받기 전까지 true (재동기화 요청 중복 방지용)
+    const bool IsAwaitingKeyframe() const { return m_bAwaitingKeyframe; }
+
+private:
+    uint32_t m_Version{ 0 };
+    bool m_bAwaitingKeyframe{ false };
+
+    sBoardState m_State{};
+};
@@ -6,246 +6,134 @@
 #include "../utils/Timer.h"
 #include "../utils/Logger.h"
 #include "../GameConfig.h"
+#include "../engine/GameEngine.h"
+#include "../engine/TickClock.h"
+#include "../bot/BotController.h"
+#include "RollbackTimeline.h"
 
 using namespace Tetris;
 
 MultiPlayLogic::MultiPlayLogic(uint64_t bagSeed)
     : m_bagSeed(bagSeed)
 {
-    m_Board[0] = std::make_unique<Board>();
-    m_Board[1] = std::make_unique<Board>();
+    m_Engine = std::make_unique<GameEngine>(bagSeed);
+    m_Clock = std::make_unique<SteadyTickClock>();
 
-    m_Bag[0] = std::make_unique<BagRandom>();
-    m_Bag[1] = std::make_unique<BagRandom>();
+    m_RemoteBoard = std::make_unique<Board>();
+    m_RemoteCurMino = std::make_unique<Tetromino>();
 
-    m_CurMino[0] = std::make_unique<Tetromino>();
-    m_CurMino[1] = std::make_unique<Tetromino>();
-
-    m_HoldType.fill(Tetris::TetrominoType::None);
     m_bGameOver.fill(false);
 
-    m_Score = std::make_unique<Score>();
-
-    m_GravityTimer = std::make_unique<Timer>();
     m_PlayTimer = std::make_unique<Timer>();
     m_ComboTimer = std::make_unique<Timer>();
 }
 
 MultiPlayLogic::~MultiPlayLogic() = default;
 
-void MultiPlayLogic::Init()
+void MultiPlayLogic::EnableRemoteBot(const sBotConfig& config)
 {
-    m_Bag[0]->Seed(m_bagSeed);
-    m_Bag[1]->Seed(m_bagSeed);
-
-    TrySpawnMino(PlayerSide::Local);
-    TrySpawnMino(PlayerSide::Remote, true);
-
-    UpdateGhost(PlayerSide::Local);
-    UpdateGhost(PlayerSide::Remote);
-
-    UpdatePreview(PlayerSide::Local);
-    UpdatePreview(PlayerSide::Remote);
-
-    m_GravityTimer->Start();
-    m_SoftDropTimer->Start();
-    m_PlayTimer->Start();
-    m_ComboTimer->Start();
+    // 같은 시드의 엔진을 하나 더 두고 봇이 조작
+    m_RemoteEngine = std::make_unique<GameEngine>(m_bagSeed);
+    m_Bot = std::make_unique<BotController>(config);
 }
 
-void MultiPlayLogic::Update()
+void MultiPlayLogic::EnableRollback()
 {
-    if (m_bGameOver[0] || m_bGameOver[1])
-        return;
-
-    if(m_GravityTimer->ElapsedMS() >= GravityIntervalMS())
-    {
-        if (!TryMove(PlayerSide::Local, 0, +1))
-        {
-            LockAndProceed(PlayerSide::Local);
-        }
-        else
-        {
-            m_GravityTimer->Restart();
-        }
-    }
+    // Remote 도 같은 시드 엔진으로 서버가 중계한 입력을 재현
+    m_RemoteEngine = std::make_unique<GameEngine>(m_bagSeed);
 
-    UpdateGhost(PlayerSide::Local);
-    UpdatePreview(PlayerSide::Local);
+    m_LocalTimeline = std::make_unique<RollbackTimeline>(*m_Engine);
+    m_RemoteTimeline = std::make_unique<RollbackTimeline>(*m_RemoteEngine);
 }
 
-// [Local Only]
-bool MultiPlayLogic::TryMove(PlayerSide side, int dx, int dy)
+void MultiPlayLogic::Init()
 {
-    if (side != PlayerSide::Local)
-    {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return false;
-    }
-
-    int i = Idx(side);
-    auto* cur = m_CurMino[i].get();
+    // 같은 시드로 Local 엔진 초기화 (첫 미노 스폰)
+    m_Engine->Reset(m_bagSeed);
+    HandleLocalEvents();
 
-    if (!cur)
-        return false;
-
-    if (m_Board[i]->IsCollide(*cur, dx, dy))
-        return false;
-
-    cur->SetPos(cur->GetX() + dx, cur->GetY() + dy);
-    m_bSyncCurMino = true;
-
-    return true;
-}
+    // Remote 는 서버로부터 상태를 받기 전까지 같은 시드의 첫 미노로 표시
+    BagRandom remoteBag(m_bagSeed);
+    m_RemoteCurMino->SetType(remoteBag.Next());
+    m_RemoteCurMino->SetPos(BOARD_WIDTH / 2, 1);
+    m_RemoteCurMino->SetRotation(Tetris::Rotation::R0);
 
-// [Local Only]
-bool MultiPlayLogic::TryRotateCW(PlayerSide side)
-{
-    if (side != PlayerSide::Local)
-    {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return false;
-    }
-
-    int i = Idx(side);
-    auto* cur = m_CurMino[i].get();
+    for (int p = 0; p < Tetris::MINO_PREVIEW_COUNT; ++p)
+        m_RemotePreview[p] = remoteBag.Peek(p);
 
-    if (!cur)
-        return false;
+    m_bRemoteGhostDirty = true;
+    UpdateRemoteGhost();
 
-    auto prev = cur->GetRotation();
-    cur->RotateCW();
+    if (m_RemoteEngine)
+        m_RemoteEngine->Reset(m_bagSeed);
 
-    if (m_Board[i]->IsCollide(*cur, 0, 0))
+    if (m_Bot)
     {
-        cur->SetRotation(prev);
-        return false;
+        m_BotRequestedPieces = -1;
+        RequestBotPlan();
     }
-    m_bSyncCurMino = true;
-
-    return true;
-}
 
-// [Local Only]
-bool MultiPlayLogic::TryRotateCCW(PlayerSide side)
-{
-    if (side != PlayerSide::Local)
+    // 롤백 기준 스냅샷 = 시작 상태
+    if (m_LocalTimeline)
     {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return false;
+        m_LocalTimeline->Reset();
+        m_RemoteTimeline->Reset();
+        m_vUnsentInputs.clear();
     }
 
-    int i = Idx(side);
-    auto* cur = m_CurMino[i].get();
-
-    if (!cur)
-        return false;
-
-    auto prev = cur->GetRotation();
-    cur->RotateCCW();
-
-    if (m_Board[i]->IsCollide(*cur, 0, 0))
-    {
-        cur->SetRotation(prev);
-        return false;
-    }
-    m_bSyncCurMino = true;
-
-    return true;
+    m_LastTick = m_Clock->Now();
+    m_PlayTimer->Start();
+    m_ComboTimer->Start();
 }
 
-// [Local Only]
-bool MultiPlayLogic::TryHold(PlayerSide side)
+void MultiPlayLogic::Update(uint8_t inputs)
 {
-    if (side != PlayerSide::Local)
-    {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return false;
-    }
-
-    int i = Idx(side);
-    if (m_bHasHeldThisTurn)
-        return false;
-
-    auto* cur = m_CurMino[i].get();
-    if (!cur)
-        return false;
-
-    if (m_HoldType[i] == Tetris::TetrominoType::None)
-    {
-        m_HoldType[i] = cur->GetType();
-        TrySpawnMino(side);
-    }
-    else
-    {
-        Tetromino tmp(m_HoldType[i]);
-        tmp.SetPos(BOARD_WIDTH / 2, 1);
+    // 이전 Update 의 이벤트는 이미 소비됨
+    m_Engine->ClearEvents();
 
-        if (m_Board[i]->IsCollide(tmp, 0, 0))
-            return false;
+    const uint64_t now = m_Clock->Now();
+    const uint32_t elapsed = static_cast<uint32_t>(now - m_LastTick);
+    m_LastTick = now;
 
-        Tetris::TetrominoType oldType = cur->GetType();
-
-        cur->SetType(m_HoldType[i]);
-        cur->SetRotation(Tetris::Rotation::R0);
-        cur->SetPos(BOARD_WIDTH / 2, 1);
-
-        m_HoldType[i] = oldType;
-    }
+    if (m_bGameOver[0] || m_bGameOver[1])
+        return;
 
-    m_bHasHeldThisTurn = true;
-    m_bSyncHold = true;
-    return true;
-}
+    // 중력 낙하는 이벤트가 없으므로 위치 비교로 Sync 여부 판단
+    const Tetromino* cur = m_Engine->GetCurMino();
+    const Tetromino prev = cur ? *cur : Tetromino();
 
-// [Local Only]
-void MultiPlayLogic::HardDrop(PlayerSide side)
-{
-    if (side != PlayerSide::Local)
+    if (m_LocalTimeline && inputs != INPUT_NONE && !m_Engine->IsGameOver())
     {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return;
+        // 예측 입력: 적용 직전 스냅샷과 함께 보관 (서버가 다른 tick 에 적용하면 여기서부터 재시뮬레이션)
+        m_vUnsentInputs.push_back({ m_Engine->GetTick(), inputs });
+        m_LocalTimeline->AddInput(m_Engine->GetTick(), inputs);
+        inputs = INPUT_NONE;
     }
 
-    int i = Idx(side);
-    auto* cur = m_CurMino[i].get();
+    m_Engine->Step(inputs, elapsed);
 
-    int dropped = 0;
-    while (TryMove(side, 0, 1))
-        ++dropped;
+    cur = m_Engine->GetCurMino();
+    if (cur && (cur->GetType() != prev.GetType() || cur->GetX() != prev.GetX() || cur->GetY() != prev.GetY() || cur->GetRotation() != prev.GetRotation()))
+        m_bSyncCurMino = true;
 
-    if (dropped > 0)
-        m_Score->AddHardDrop(dropped);
+    HandleLocalEvents();
 
-    LockAndProceed(side);
+    if (m_Bot)
+        UpdateRemoteBot(now, elapsed);
+    else if (m_RemoteTimeline)
+        PredictRemote();
 }
 
-// [Local Only]
-bool MultiPlayLogic::TrySoftDrop(Tetris::PlayerSide side)
+bool MultiPlayLogic::IsGameOver(PlayerSide side) const
 {
-    if (side != PlayerSide::Local)
-    {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return false;
-    }
-
-    int i = Idx(side);
-    auto* cur = m_CurMino[i].get();
+    // 롤백 예측 중에는 Local / Remote 모두 서버 판정만 따름 (예측 TopOut 은 재시뮬레이션으로 뒤집힐 수 있음)
+    if (side == PlayerSide::Local && !m_LocalTimeline && m_Engine->IsGameOver())
+        return true;
 
-    if (TryMove(side, 0, +1))
-    {
-        m_Score->AddSoftDrop(1);
-        m_GravityTimer->Restart();
+    if (side == PlayerSide::Remote && m_Bot && m_RemoteEngine->IsGameOver())
         return true;
-    }
 
-    return false;
+    return m_bGameOver[Idx(side)];
 }
 
 void MultiPlayLogic::SetGameOver(PlayerSide side)
@@ -255,69 +143,110 @@ void MultiPlayLogic::SetGameOver(PlayerSide side)
 
 void MultiPlayLogic::ApplyEnemyMinoState(const sMinoState& state)
 {
-    int i = Idx(PlayerSide::Remote);
-
-    auto* cur = m_CurMino[i].get();
+    auto* cur = m_RemoteCurMino.get();
     cur->SetType(static_cast<Tetris::TetrominoType>(state.type));
     cur->SetPos(state.x, state.y);
     cur->SetRotation(static_cast<Tetris::Rotation>(state.rot));
 
-    UpdateGhost(PlayerSide::Remote);
+    m_bRemoteGhostDirty = true;
+    UpdateRemoteGhost();
 }
 
 void MultiPlayLogic::ApplyEnemyHoldState(Tetris::TetrominoType type)
 {
-    int i = Idx(PlayerSide::Remote);
-
-    m_HoldType[i] = static_cast<Tetris::TetrominoType>(type);
+    m_RemoteHoldType = static_cast<Tetris::TetrominoType>(type);
 }
 
 void MultiPlayLogic::ApplyEnemyPreviewState(const sPreviewMinoState& state)
 {
-    int i = Idx(PlayerSide::Remote);
-
     for (int p = 0; p < Tetris::MINO_PREVIEW_COUNT; ++p)
     {
-        m_PreviewMinos[i][p] = static_cast<Tetris::TetrominoType>(state.previewTypes[p]);
+        m_RemotePreview[p] = static_cast<Tetris::TetrominoType>(state.previewTypes[p]);
     }
 }
 
 void MultiPlayLogic::ApplyEnemyBoardState(const sBoardState& state)
 {
-    int i = Idx(PlayerSide::Remote);
-
-    for (int c = 0; c < state.cells.size(); ++c)
-    {
-        int x = c % BOARD_WIDTH;
-        int y = c / BOARD_WIDTH;
+    // 셀 일괄 적용 후 열 높이 한 번만 재계산
+    m_RemoteBoard->FromPacket(state);
 
-        m_Board[i]->Set(x, y, state.cells[c]);
-    }
+    m_bRemoteGhostDirty = true;
+    UpdateRemoteGhost();
 }
 
-Board* MultiPlayLogic::GetBoard(PlayerSide side) const
+const Board* MultiPlayLogic::GetBoard(PlayerSide side) const
 {
-    return m_Board[Idx(side)].get();
+    if (side == PlayerSide::Local)
+        return &m_Engine->GetBoard();
+
+    if (m_RemoteEngine)
+        return &m_RemoteEngine->GetBoard();
+
+    return m_RemoteBoard.get();
 }
 
-Tetromino* MultiPlayLogic::GetCurMino(PlayerSide side) const
+const Tetromino* MultiPlayLogic::GetCurMino(PlayerSide side) const
 {
-    return m_CurMino[Idx(side)].get();
+    if (side == PlayerSide::Local)
+        return m_Engine->GetCurMino();
+
+    if (m_RemoteEngine)
+        return m_RemoteEngine->GetCurMino();
+
+    return m_RemoteCurMino.get();
 }
 
-Tetromino* MultiPlayLogic::GetGhostMino(PlayerSide side) const
+const Tetromino* MultiPlayLogic::GetGhostMino(PlayerSide side) const
 {
-    return m_GhostMino[Idx(side)].get();
+    if (side == PlayerSide::Local)
+        return m_Engine->GetGhostMino();
+
+    if (m_RemoteEngine)
+        return m_RemoteEngine->GetGhostMino();
+
+    return m_RemoteGhostMino.get();
 }
 
 Tetris::TetrominoType MultiPlayLogic::GetHoldType(PlayerSide side) const
 {
-    return m_HoldType[Idx(side)];
+    if (side == PlayerSide::Local)
+        return m_Engine->GetHoldType();
+
+    if (m_RemoteEngine)
+        return m_RemoteEngine->GetHoldType();
+
+    return m_RemoteHoldType;
 }
 
 const std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT>& MultiPlayLogic::GetPreview(PlayerSide side) const
 {
-    return m_PreviewMinos[Idx(side)];
+    if (side == PlayerSide::Local)
+        return m_Engine->GetPreview();
+
+    if (m_RemoteEngine)
+        return m_RemoteEngine->GetPreview();
+
+    return m_RemotePreview;
+}
+
+const Score& MultiPlayLogic::GetScore() const
+{
+    return m_Engine->GetScore();
+}
+
+int MultiPlayLogic::GetTotalPieces() const
+{
+    return m_Engine->GetTotalPieces();
+}
+
+const std::vector<Tetris::sEngineEvent>& MultiPlayLogic::GetLocalEvents() const
+{
+    return m_Engine->GetEvents();
+}
+
+const sClearedLines* MultiPlayLogic::GetLocalClearedSinceSync() const
+{
+    return (m_LocalLocksSinceSync == 1) ? &m_Engine->GetLastCleared() : nullptr;
 }
 
 void MultiPlayLogic::ClearSyncFlags()
@@ -326,111 +255,150 @@ void MultiPlayLogic::ClearSyncFlags()
     m_bSyncHold = false;
     m_bSyncPreview = false;
     m_bSyncBoard = false;
+    m_LocalLocksSinceSync = 0;
 }
 
-void MultiPlayLogic::ClearSoundFlags()
+uint64_t MultiPlayLogic::GetLocalTick() const
 {
-    m_bPlayFloorSE = false;
-    m_bPlayComboSE = false;
+    return m_Engine->GetTick();
 }
 
-// [Local Only]
-bool MultiPlayLogic::TrySpawnMino(PlayerSide side, bool bInit)
+void MultiPlayLogic::CorrectLocalInput(uint64_t tick, uint64_t appliedTick)
 {
-    if (side != PlayerSide::Local && !bInit)
-    {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
-        return false;
-    }
-
-    int i = Idx(side);
-
-    Tetromino tempMino(m_Bag[i]->Peek(0));
-    tempMino.SetPos(BOARD_WIDTH / 2, 1);
+    if (!m_LocalTimeline->CorrectInput(tick, appliedTick))
+        TETRIS_ERROR("InputCorrection for unknown tick!");
+}
 
-    if (m_Board[i]->IsCollide(tempMino, 0, 0))
-    {
-        SetGameOver(side);
-        return false;
-    }
+void MultiPlayLogic::ConfirmLocal(uint64_t tick)
+{
+    m_LocalTimeline->Confirm(tick);
+}
 
-    m_CurMino[i] = std::make_unique<Tetromino>(m_Bag[i]->Next());
-    m_CurMino[i]->SetPos(BOARD_WIDTH / 2, 1);
-    m_CurMino[i]->SetRotation(Tetris::Rotation::R0);
+void MultiPlayLogic::ApplyRemoteInput(uint64_t tick, uint8_t inputs)
+{
+    m_RemoteTimeline->AddInput(tick, inputs);
+}
 
-    UpdatePreview(side);
-    return true;
+void MultiPlayLogic::ConfirmRemote(uint64_t tick)
+{
+    m_RemoteTimeline->Confirm(tick);
 }
 
-// [Local Only]
-void MultiPlayLogic::LockAndProceed(PlayerSide side)
+void MultiPlayLogic::Reconcile()
 {
-    if (side != PlayerSide::Local)
-    {
-        TETRIS_ERROR("side must be Local Only");
-        __debugbreak();
+    if (!m_LocalTimeline)
         return;
-    }
 
-    int i = Idx(side);
-    auto* cur = m_CurMino[i].get();
+    // 엔진은 입력 tick 만 같으면 서버와 같은 결과 → 서버가 적용한 tick 으로 다시 진행
+    // 진행 tick 은 다음 Sync 에 보고
+    if (m_LocalTimeline->Resimulate() > 0)
+        m_bSyncCurMino = true;
+
+    m_RemoteTimeline->Resimulate();
+}
 
-    m_totalPieces++;
+void MultiPlayLogic::PredictRemote()
+{
+    // Remote 이벤트는 쓰지 않음 (효과음은 Local 만)
+    m_RemoteEngine->ClearEvents();
 
-    m_Board[i]->Lock(*cur);
-    int cleared = m_Board[i]->ClearFullLines();
+    // 중계가 끊기면 너무 멀리 예측하지 않고 멈춤
+    const uint64_t horizon = m_RemoteTimeline->GetConfirmedTick() + MAX_REMOTE_PREDICTION_TICKS;
+    m_RemoteTimeline->AdvanceTo(std::min(m_Engine->GetTick(), horizon));
+}
 
-    if (cleared > 0)
+void MultiPlayLogic::HandleLocalEvents()
+{
+    for (const auto& ev : m_Engine->GetEvents())
     {
-        m_bShowCombo = true;
+        switch (ev.type)
+        {
+        case EngineEventType::Spawn:
+            m_bSyncCurMino = true;
+            m_bSyncPreview = true;
+            break;
+
+        case EngineEventType::Move:
+        case EngineEventType::Rotate:
+        case EngineEventType::SoftDrop:
+        case EngineEventType::HardDrop:
+            m_bSyncCurMino = true;
+            break;
+
+        case EngineEventType::Hold:
+            m_bSyncCurMino = true;
+            m_bSyncHold = true;
+            break;
+
+        case EngineEventType::Lock:
+            m_bSyncBoard = true;
+            ++m_LocalLocksSinceSync;
+            break;
+
+        case EngineEventType::Combo:
+            m_bShowCombo = true;
+            break;
+
+        case EngineEventType::TopOut:
+            if (!m_LocalTimeline)
+                SetGameOver(PlayerSide::Local);
+            break;
+
+        default:
+            break;
+        }
     }
+}
 
-    bool tSpin = false;
-    m_Score->OnLinesCleared(cleared, tSpin);
+void MultiPlayLogic::UpdateRemoteGhost()
+{
+    // 미노가 움직이거나 보드가 바뀐 경우에만 재계산
+    if (!m_bRemoteGhostDirty && m_RemoteGhostMino)
+        return;
 
-    m_bHasHeldThisTurn = false;
-    TrySpawnMino(side);
+    if (m_RemoteGhostMino)
+        *m_RemoteGhostMino = *m_RemoteCurMino;
+    else
+        m_RemoteGhostMino = std::make_unique<Tetromino>(*m_RemoteCurMino);
 
-    m_bSyncBoard = true;
-    m_bPlayFloorSE = true;
+    auto* ghost = m_RemoteGhostMino.get();
+    ghost->SetPos(ghost->GetX(), ghost->GetY() + m_RemoteBoard->DropDistance(*ghost));
+    m_bRemoteGhostDirty = false;
 }
 
-void MultiPlayLogic::UpdateGhost(PlayerSide side)
+void MultiPlayLogic::UpdateRemoteBot(uint64_t now, uint32_t elapsed)
 {
-    int i = Idx(side);
+    m_RemoteEngine->ClearEvents();
+
+    // 탐색은 워커 스레드에서 진행되므로 여기서는 준비된 입력만 꺼내 씀
+    m_RemoteEngine->Step(m_Bot->NextInput(now, m_RemoteEngine->GetCurMino()), elapsed);
 
-    if (!m_CurMino[i])
+    if (m_RemoteEngine->IsGameOver())
+    {
+        SetGameOver(PlayerSide::Remote);
         return;
+    }
 
-    m_GhostMino[i] = std::make_unique<Tetromino>(*m_CurMino[i]);
-    while (!m_Board[i]->IsCollide(*m_GhostMino[i], 0, +1))
-        m_GhostMino[i]->SetPos(m_GhostMino[i]->GetX(), m_GhostMino[i]->GetY() + 1);
+    RequestBotPlan();
 }
 
-void MultiPlayLogic::UpdatePreview(PlayerSide side)
+void MultiPlayLogic::RequestBotPlan()
 {
-    int i = Idx(side);
-    for (int p = 0; p < Tetris::MINO_PREVIEW_COUNT; ++p)
-        m_PreviewMinos[i][p] = m_Bag[i]->Peek(p);
+    // 홀드로 새 미노가 나온 경우는 같은 계획의 일부이므로 고정 횟수로만 판단
+    // 중력 때문에 경로가 어긋났으면 같은 미노라도 현재 자세에서 다시 탐색
+    const int pieces = m_RemoteEngine->GetTotalPieces();
+    const Tetromino* cur = m_RemoteEngine->GetCurMino();
+    if (!cur || (pieces == m_BotRequestedPieces && !m_Bot->NeedsReplan()))
+        return;
 
-    if (side == PlayerSide::Local)
-        m_bSyncPreview = true;
-}
+    sBotRequest request;
+    request.board = m_RemoteEngine->GetBoard();
+    request.curType = cur->GetType();
+    request.curPose = { cur->GetX(), cur->GetY(), cur->GetRotation() };
+    request.holdType = m_RemoteEngine->GetHoldType();
+    request.preview = m_RemoteEngine->GetPreview();
+    request.bCanHold = m_RemoteEngine->CanHold();
 
-void MultiPlayLogic::OnComboAchieved(int combo)
-{
-    m_ComboString = "combo_" + std::to_string(combo);
-    m_bPlayComboSE = true;
-    m_bShowCombo = true;
+    m_Bot->Request(request);
+    m_BotRequestedPieces = pieces;
 }
-
-int MultiPlayLogic::GravityIntervalMS() const
-{
-    int level = std::max(1, m_Score->GetLevel());
-    int base = 700;
-    int step = 50;
-    int ms = base - (level - 1) * step;
-
-    return std::max(80, ms);
-}
\ No newline at end of file
@@ -2,119 +2,155 @@
 
 #include "../common/TetrisTypes.h"
 #include "../common/PacketProtocol.h"
+#include "../engine/EngineTypes.h"
 #include <memory>
 #include <array>
+#include <vector>
 
 class Board;
-class BagRandom;
 class Score;
 class Timer;
 class Tetromino;
+class GameEngine;
+class RollbackTimeline;
+class ITickClock;
+class BotController;
+struct sClearedLines;
+struct sBotConfig;
 
 class MultiPlayLogic
 {
 public:
+    // 롤백: 상대의 확정 tick 이후로 예측하는 최대 범위
+    // (상대는 입력이 없으면 중력으로 미노가 움직일 때만 진행 tick 을 보고하므로 최대 중력 간격보다 길게)
+    static constexpr uint64_t MAX_REMOTE_PREDICTION_TICKS = 1000;
+
     MultiPlayLogic(uint64_t bagSeed);
     ~MultiPlayLogic();
 
     void Init();
-    void Update();
-
-    // ---   ---
-    bool TryMove(Tetris::PlayerSide side, int dx, int dy);
-    bool TryRotateCW(Tetris::PlayerSide side);
-    bool TryRotateCCW(Tetris::PlayerSide side);
-    bool TryHold(Tetris::PlayerSide side);
-    void HardDrop(Tetris::PlayerSide side);
-    bool TrySoftDrop(Tetris::PlayerSide side);
-
-    // ---  ---
-    bool IsGameOver(Tetris::PlayerSide side) const { return m_bGameOver[(int)side]; }
-    void SetGameOver(Tetris::PlayerSide side);
 
-    int GravityIntervalMS() const;
-    std::string GetComboString() const { return m_ComboString; }
+    // Remote 측을 서버 대신 로컬 봇이 플레이 (오프라인 연습용, Init 전에 호출)
+    void EnableRemoteBot(const sBotConfig& config);
+    bool HasRemoteBot() const { return m_Bot != nullptr; }
+
+    // 서버 권한 모드: 두 플레이어를 같은 엔진으로 예측하고 서버 확정에 맞춰 롤백 (Init 전에 호출)
+    void EnableRollback();
+    bool IsRollbackEnabled() const { return m_LocalTimeline != nullptr; }
+
+    // Local 입력 적용 후 경과 시간만큼 엔진 진행 (Tetris::InputFlag 조합)
+    void Update(uint8_t inputs);
 
-    // --- ܺο  ޵  Ʈ ---
+    // --- 상태 ---
+    bool IsGameOver(Tetris::PlayerSide side) const;
+    void SetGameOver(Tetris::PlayerSide side);
+
+    // --- 외부에서 서버로 전달된 상태 업데이트 ---
     void ApplyEnemyMinoState(const sMinoState& state);
     void ApplyEnemyHoldState(Tetris::TetrominoType type);
     void ApplyEnemyPreviewState(const sPreviewMinoState& state);
     void ApplyEnemyBoardState(const sBoardState& state);
 
-    // ---  Getter ---
-    Board* GetBoard(Tetris::PlayerSide side) const;
-    Tetromino* GetCurMino(Tetris::PlayerSide side) const;
-    Tetromino* GetGhostMino(Tetris::PlayerSide side) const;
+    // --- 렌더링용 Getter ---
+    const Board* GetBoard(Tetris::PlayerSide side) const;
+    const Tetromino* GetCurMino(Tetris::PlayerSide side) const;
+    const Tetromino* GetGhostMino(Tetris::PlayerSide side) const;
     Tetris::TetrominoType GetHoldType(Tetris::PlayerSide side) const;
     const std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT>&
         GetPreview(Tetris::PlayerSide side) const;
 
-    const Score& GetScore() { return *m_Score; }
+    const Score& GetScore() const;
     const Timer& GetPlayTimer() { return *m_PlayTimer; }
-    int GetTotalPieces() { return m_totalPieces; }
+    int GetTotalPieces() const;
     bool& GetShowCombo() { return m_bShowCombo; }
     Timer& GetComboTimer() { return *m_ComboTimer; }
 
+    // 이번 Update 에서 Local 엔진이 발생시킨 이벤트 (사운드 처리용)
+    const std::vector<Tetris::sEngineEvent>& GetLocalEvents() const;
+
     bool ShouldSyncCurMino() const { return m_bSyncCurMino; }
     bool ShouldSyncHold() const { return m_bSyncHold; }
     bool ShouldSyncPreview() const { return m_bSyncPreview; }
     bool ShouldSyncBoard() const { return m_bSyncBoard; }
 
-    bool ShouldPlayFloorSE() const { return m_bPlayFloorSE; }
-    bool ShouldPlayComboSE() const { return m_bPlayComboSE; }
+    // 마지막 Sync 이후 고정이 한 번뿐이면 그 라인 클리어 결과 (델타 인코딩용), 아니면 nullptr
+    const sClearedLines* GetLocalClearedSinceSync() const;
 
     void ClearSyncFlags();
-    void ClearSoundFlags();
+
+    // --- 서버 권한 모드 (롤백) ---
+    // 아직 서버로 보내지 않은 Local 입력 (tick = 적용한 Local 엔진 tick)
+    const std::vector<sInputEvent>& GetUnsentInputs() const { return m_vUnsentInputs; }
+    void ClearUnsentInputs() { m_vUnsentInputs.clear(); }
+    uint64_t GetLocalTick() const;
+
+    // 서버가 tick 의 입력을 appliedTick 에 적용함 / tick 까지 확정
+    void CorrectLocalInput(uint64_t tick, uint64_t appliedTick);
+    void ConfirmLocal(uint64_t tick);
+
+    // 서버가 중계한 상대의 확정 입력 / tick 까지 확정 (이후는 입력 없음으로 예측)
+    void ApplyRemoteInput(uint64_t tick, uint8_t inputs);
+    void ConfirmRemote(uint64_t tick);
+
+    // 받은 보정 / 확정 입력을 반영: 되감아서 현재 tick 까지 재시뮬레이션 (패킷 처리 후 한 번)
+    void Reconcile();
 
 private:
-    bool TrySpawnMino(Tetris::PlayerSide side, bool bInit = false);
-    void LockAndProceed(Tetris::PlayerSide side);
-    void UpdateGhost(Tetris::PlayerSide side);
-    void UpdatePreview(Tetris::PlayerSide side);
-    void OnComboAchieved(int combo);
+    // 엔진 이벤트 → 서버 Sync Flags
+    void HandleLocalEvents();
+    void UpdateRemoteGhost();
+
+    // 롤백: Remote 를 확정 tick 이후 입력 없음으로 Local tick 까지 예측
+    void PredictRemote();
 
-    
+    // 봇 입력으로 Remote 엔진 진행 + 새 미노면 탐색 요청
+    void UpdateRemoteBot(uint64_t now, uint32_t elapsed);
+    void RequestBotPlan();
 
 private:
     int Idx(Tetris::PlayerSide side) const { return (side == Tetris::PlayerSide::Local) ? 0 : 1; }
 
 private:
-    // ---   ---
-    std::array<std::unique_ptr<Board>, 2> m_Board;
-    std::array<std::unique_ptr<BagRandom>, 2> m_Bag;
-    std::array<std::unique_ptr<Tetromino>, 2> m_CurMino;
-    std::array<std::unique_ptr<Tetromino>, 2> m_GhostMino;
+    // --- Local: 규칙은 엔진이 담당 ---
+    std::unique_ptr<GameEngine> m_Engine;
+    std::unique_ptr<ITickClock> m_Clock;
+    uint64_t m_LastTick{ 0 };
 
-    std::array< std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT>, 2 > m_PreviewMinos;
+    // --- Remote: 서버로부터 받은 상태를 그대로 보관 ---
+    std::unique_ptr<Board> m_RemoteBoard;
+    std::unique_ptr<Tetromino> m_RemoteCurMino;
+    std::unique_ptr<Tetromino> m_RemoteGhostMino;
+    bool m_bRemoteGhostDirty{ true };
 
-    std::array<Tetris::TetrominoType, 2> m_HoldType;
+    std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT> m_RemotePreview{};
+    Tetris::TetrominoType m_RemoteHoldType{ Tetris::TetrominoType::None };
+
+    // --- Remote 엔진: 봇 조작 또는 롤백 예측. 설정된 경우 위의 서버 상태 대신 사용 ---
+    std::unique_ptr<GameEngine> m_RemoteEngine;
+    std::unique_ptr<BotController> m_Bot;
+    int m_BotRequestedPieces{ -1 };     // 마지막으로 탐색 요청한 시점의 GetTotalPieces
 
     uint64_t m_bagSeed = 0;
 
     // --- Game State ---
     std::array<bool, 2> m_bGameOver;
-    bool m_bHasHeldThisTurn{ false };
-    std::string m_ComboString{};
 
-    // --- Ÿ̸/ ---
-    std::unique_ptr<Score> m_Score;
-    std::unique_ptr<Timer> m_GravityTimer;
+    // --- 타이머 ---
     std::unique_ptr<Timer> m_PlayTimer;
     std::unique_ptr<Timer> m_ComboTimer;
 
-    int m_totalPieces{ 0 };
-
-    // ---    Sync Flags ---
+    // --- 서버로 보내야 할 Sync Flags ---
     bool m_bSyncCurMino{ false };
     bool m_bSyncHold{ false };
     bool m_bSyncPreview{ false };
     bool m_bSyncBoard{ false };
+    int m_LocalLocksSinceSync{ 0 };
 
-    // ---  û Event Flags ---
-    bool m_bPlayFloorSE{ false };
-    bool m_bPlayComboSE{ false };
-
+    // --- 서버 권한 모드 (롤백) ---
+    std::unique_ptr<RollbackTimeline> m_LocalTimeline;
+    std::unique_ptr<RollbackTimeline> m_RemoteTimeline;
+    std::vector<sInputEvent> m_vUnsentInputs;
 
-    // ---    Sync Flags ---
+    // --- 렌더러로 보내야 할 Sync Flags ---
     bool m_bShowCombo{ false };
 };
\ No newline at end of file
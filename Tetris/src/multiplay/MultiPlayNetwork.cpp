@@ -32,19 +32,27 @@ void MultiPlayNetwork::SyncToServer()
     if (!IsConnected())
         return;
 
-    // Local CurMino 
+    // 서버 권한 모드: 상태는 서버가 계산하므로 입력만 보냄
+    if (m_Logic.IsRollbackEnabled())
+    {
+        SendInputs();
+        m_Logic.ClearSyncFlags();
+        return;
+    }
+
+    // Local CurMino 변경됨
     if (m_Logic.ShouldSyncCurMino())
         SendCurMino();
 
-    // Local Hold 
+    // Local Hold 변경됨
     if (m_Logic.ShouldSyncHold())
         SendHold();
 
-    // Local Preview 
+    // Local Preview 변경됨
     if (m_Logic.ShouldSyncPreview())
         SendPreview();
 
-    // Local Board  (Lock & Proceed)
+    // Local Board 변경됨 (Lock & Proceed)
     if (m_Logic.ShouldSyncBoard())
         SendBoard();
 
@@ -66,63 +74,132 @@ void MultiPlayNetwork::ProcessPackets()
         {
             sp::net::message<GameMsg> pong;
             pong.header.id = GameMsg::Client_Pong;
-            m_Client->Send(pong);
+            m_Client->Send(std::move(pong));
             break;
         }
 
         case GameMsg::Game_CurMinoState:
         {
+            sMinoStateWire wire;
             sMinoState state;
-            msgIn >> state;
-            m_Logic.ApplyEnemyMinoState(state);
+            if (ReadWire(msgIn, wire) && UnpackMinoState(wire, state))
+                m_Logic.ApplyEnemyMinoState(state);
+            else
+                TETRIS_ERROR("Invalid Game_CurMinoState!");
             break;
         }
 
         case GameMsg::Game_HoldMinoState:
         {
+            sMinoStateWire wire;
             sMinoState state;
-            msgIn >> state;
-            m_Logic.ApplyEnemyHoldState(
-                static_cast<Tetris::TetrominoType>(state.type));
+            if (ReadWire(msgIn, wire) && UnpackMinoState(wire, state))
+                m_Logic.ApplyEnemyHoldState(static_cast<Tetris::TetrominoType>(state.type));
+            else
+                TETRIS_ERROR("Invalid Game_HoldMinoState!");
             break;
         }
 
         case GameMsg::Game_PreviewMinoState:
         {
+            sPreviewMinoStateWire wire;
             sPreviewMinoState state;
-            msgIn >> state;
-            m_Logic.ApplyEnemyPreviewState(state);
+            if (ReadWire(msgIn, wire) && UnpackPreviewState(wire, state))
+                m_Logic.ApplyEnemyPreviewState(state);
+            else
+                TETRIS_ERROR("Invalid Game_PreviewMinoState!");
             break;
         }
 
         case GameMsg::Game_BoardState:
         {
+            sBoardStateWire wire;
             sBoardState state;
-            msgIn >> state;
-            m_Logic.ApplyEnemyBoardState(state);
+            if (ReadWire(msgIn, wire) && UnpackBoardState(wire, state))
+                m_Logic.ApplyEnemyBoardState(state);
+            else
+                TETRIS_ERROR("Invalid Game_BoardState!");
+            break;
+        }
+
+        case GameMsg::Game_BoardDelta:
+        {
+            const bool bWasAwaiting = m_BoardDecoder.IsAwaitingKeyframe();
+
+            if (m_BoardDecoder.Apply(msgIn) == BoardDeltaDecoder::Result::Applied)
+                m_Logic.ApplyEnemyBoardState(m_BoardDecoder.GetState());
+            else if (!bWasAwaiting)
+                SendBoardResyncRequest();   // 키프레임이 올 때까지 한 번만 요청
+            break;
+        }
+
+        case GameMsg::Game_BoardResyncRequest:
+        {
+            // 상대가 버전 누락 → 다음 전송을 키프레임으로 즉시 보냄
+            m_BoardEncoder.RequestKeyframe();
+            SendBoard();
+            break;
+        }
+
+        case GameMsg::Game_InputCorrection:
+        {
+            // 서버가 입력을 늦게 받아 다른 tick 에 적용 → 루프가 끝나면 그 tick 으로 다시 시뮬레이션
+            sInputCorrection correction;
+            if (!ReadWire(msgIn, correction))
+            {
+                TETRIS_ERROR("Invalid Game_InputCorrection!");
+                break;
+            }
+
+            m_Logic.CorrectLocalInput(correction.tick.Get(), correction.appliedTick.Get());
+            break;
+        }
+
+        case GameMsg::Game_InputAck:
+        {
+            // 이 tick 까지 보낸 입력은 더 이상 보정되지 않음 → 스냅샷 정리
+            sNetU32 tick;
+            if (!ReadWire(msgIn, tick))
+            {
+                TETRIS_ERROR("Invalid Game_InputAck!");
+                break;
+            }
+
+            m_Logic.ConfirmLocal(tick.Get());
+            break;
+        }
+
+        case GameMsg::Game_InputBatch:
+        {
+            ReceiveRemoteInputs(msgIn);
             break;
         }
 
         case GameMsg::Game_PlayerDead:
         {
             sGameOverInfo info;
-            msgIn >> info;
+            if (!ReadWire(msgIn, info))
+                TETRIS_ERROR("Invalid Game_PlayerDead!");
 
-            // 밡 ׾ Local ׾ Ǻ ʿ :
-            //  Winner/Loser ˷
-            // (  MultiPlayState ó)
+            // 상대가 죽었는지 Local이 죽었는지 판별 필요 없음:
+            // 서버가 Winner/Loser 알려줌
+            // (이 로직은 MultiPlayState에서 처리)
             break;
         }
 
         case GameMsg::Server_GameOver:
         {
             sGameOverInfo info;
-            msgIn >> info;
+            if (!ReadWire(msgIn, info))
+            {
+                TETRIS_ERROR("Invalid Server_GameOver!");
+                break;
+            }
 
             bool isLocalWinner =
-                info.nWinnerID == m_Client->GetPlayerID();
+                info.nWinnerID.Get() == m_Client->GetPlayerID();
 
-            // Logic GameOver θ ݿ
+            // Logic에는 GameOver 여부만 반영
             if (isLocalWinner)
                 m_Logic.SetGameOver(PlayerSide::Remote);
             else
@@ -132,11 +209,13 @@ void MultiPlayNetwork::ProcessPackets()
         }
         }
     }
+
+    m_Logic.Reconcile();
 }
 
 void MultiPlayNetwork::SendCurMino()
 {
-    Tetromino* cur = m_Logic.GetCurMino(PlayerSide::Local);
+    const Tetromino* cur = m_Logic.GetCurMino(PlayerSide::Local);
     if (!cur)
         return;
 
@@ -148,9 +227,9 @@ void MultiPlayNetwork::SendCurMino()
 
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Game_CurMinoState;
-    msgOut << state;
+    msgOut << PackMinoState(state);
 
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
 }
 
 void MultiPlayNetwork::SendHold()
@@ -160,9 +239,9 @@ void MultiPlayNetwork::SendHold()
         
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Game_HoldMinoState;
-    msgOut << state;
+    msgOut << PackMinoState(state);
 
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
 }
 
 void MultiPlayNetwork::SendPreview()
@@ -175,29 +254,98 @@ void MultiPlayNetwork::SendPreview()
 
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Game_PreviewMinoState;
-    msgOut << state;
+    msgOut << PackPreviewState(state);
 
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
 }
 
 void MultiPlayNetwork::SendBoard()
 {
-    sBoardState state = m_Logic.GetBoard(PlayerSide::Local)->ToPacket();
-        
+    // 바뀐 행 + 지운 줄 인덱스만 전송 (고정 1회당 보통 수십 바이트)
     sp::net::message<GameMsg> msgOut;
-    msgOut.header.id = GameMsg::Game_BoardState;
-    msgOut << state;
+    m_BoardEncoder.Encode(*m_Logic.GetBoard(PlayerSide::Local), m_Logic.GetLocalClearedSinceSync(), msgOut);
 
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
+}
+
+void MultiPlayNetwork::SendInputs()
+{
+    const auto& log = m_Logic.GetUnsentInputs();
+    const uint64_t tick = m_Logic.GetLocalTick();
+
+    // 새 입력이 없으면 중력으로 미노가 움직였을 때만 진행 tick 보고 (상대 예측 범위 / 스냅샷 확정용)
+    if (log.empty() && !m_Logic.ShouldSyncCurMino() && !m_Logic.ShouldSyncBoard())
+        return;
+
+    size_t nSent = 0;
+    do
+    {
+        // 한 배치에 다 못 담으면 다음 배치 첫 입력의 tick 까지만 진행했다고 보고
+        const size_t nEnd = std::min<size_t>(log.size(), nSent + NET_MAX_INPUTS_PER_BATCH);
+        const uint64_t batchTick = (nEnd < log.size()) ? log[nEnd].tick : tick;
+
+        sp::net::message<GameMsg> msgOut;
+        msgOut.header.id = GameMsg::Game_InputBatch;
+
+        sInputBatchHeader header;
+        header.tick.Set(static_cast<uint32_t>(batchTick));
+
+        for (; nSent < nEnd; ++nSent)
+        {
+            const auto& in = log[nSent];
+
+            sInputEventWire ev;
+            ev.tickBack.Set(static_cast<uint16_t>(std::min<uint64_t>(batchTick - in.tick, UINT16_MAX)));
+            ev.inputs = in.inputs;
+
+            msgOut << ev;
+            ++header.count;
+        }
+
+        msgOut << header;
+        m_Client->Send(std::move(msgOut));
+    } while (nSent < log.size());
+
+    m_Logic.ClearUnsentInputs();
+}
+
+void MultiPlayNetwork::ReceiveRemoteInputs(sp::net::message<GameMsg>& msg)
+{
+    if (!m_Logic.IsRollbackEnabled())
+        return;
+
+    sInputBatchHeader header;
+    std::array<sInputEvent, NET_MAX_INPUTS_PER_BATCH> events;
+
+    if (!ReadInputBatch(msg, header, events))
+    {
+        TETRIS_ERROR("Invalid Game_InputBatch!");
+        return;
+    }
+
+    // 서버가 실제로 적용한 tick 이므로 그대로 재현, 되감기는 패킷 처리 후 한 번에
+    for (int i = 0; i < header.count; ++i)
+        m_Logic.ApplyRemoteInput(events[i].tick, events[i].inputs);
+
+    m_Logic.ConfirmRemote(header.tick.Get());
 }
 
 void MultiPlayNetwork::SendClientGameOver()
 {
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Game_PlayerDead;
-    msgOut << GetPlayerID();
+    msgOut << sNetU32(static_cast<uint32_t>(GetPlayerID()));
+
+    m_Client->Send(std::move(msgOut));
+}
+
+void MultiPlayNetwork::SendBoardResyncRequest()
+{
+    sp::net::message<GameMsg> msgOut;
+    msgOut.header.id = GameMsg::Game_BoardResyncRequest;
+    msgOut << sNetU32(m_BoardDecoder.GetVersion());
 
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
 }
 
 void MultiPlayNetwork::SendUnregister()
@@ -207,7 +355,7 @@ void MultiPlayNetwork::SendUnregister()
 
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Client_UnregisterWithServer;
-    msgOut << GetPlayerID();
+    msgOut << sNetU32(static_cast<uint32_t>(GetPlayerID()));
 
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../common/PacketProtocol.h"
+#include "BoardSync.h"
 #include <memory>
 
 class TetrisClient;
@@ -12,10 +13,10 @@ public:
     MultiPlayNetwork(std::unique_ptr<TetrisClient> client, MultiPlayLogic& logic);
     ~MultiPlayNetwork();
 
-    //  ۽ (Logic SyncFlag  ʿ  ȣ)
+    // 서버로 송신 (Logic에서 SyncFlag를 기반으로 필요할 때 호출)
     void SyncToServer();
 
-    //  ŵ Ŷ ó
+    // 서버에서 수신된 패킷 처리
     void ProcessPackets();
 
     // Graceful Disconnect
@@ -30,8 +31,19 @@ private:
     void SendPreview();
     void SendBoard();
     void SendClientGameOver();
+    void SendBoardResyncRequest();
+
+    // 서버 권한 모드: 상태 대신 새 입력과 진행 tick 전송
+    void SendInputs();
+
+    // 서버 권한 모드: 서버가 중계한 상대의 확정 입력
+    void ReceiveRemoteInputs(sp::net::message<GameMsg>& msg);
 
 private:
     std::unique_ptr<TetrisClient> m_Client;
     MultiPlayLogic& m_Logic;
+
+    // 보드는 델타로 주고받음 (Local 송신 / Remote 수신)
+    BoardDeltaEncoder m_BoardEncoder;
+    BoardDeltaDecoder m_BoardDecoder;
 };
\ No newline at end of file
@@ -22,11 +22,11 @@ MultiPlayRenderer::~MultiPlayRenderer() = default;
 
 void MultiPlayRenderer::InitLayout()
 {
-    // 带 ȭ   ġ
+    // 보드를 화면 가운데 기준으로 배치
     m_BoardLeft = m_CenterW - BOARD_WIDTH;
     m_BoardTop = m_CenterH - (BOARD_HEIGHT / 2);
 
-    //   (: Local, : Remote)
+    // 렌더러 생성 (왼쪽: Local, 오른쪽: Remote)
     m_LocalRenderer = std::make_unique<ConsoleRenderer>(m_Console, m_BoardLeft - 30, m_BoardTop);
     m_RemoteRenderer = std::make_unique<ConsoleRenderer>(m_Console, m_BoardLeft + 30, m_BoardTop);
 }
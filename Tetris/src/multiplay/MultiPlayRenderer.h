@@ -23,7 +23,7 @@ private:
     Console& m_Console;
     MultiPlayLogic& m_Logic;
 
-    // ȭ ġ 
+    // 화면 배치 정보
     int m_ScreenWidth{};
     int m_ScreenHeight{};
     int m_CenterW{};
@@ -33,7 +33,7 @@ private:
 
     int m_LastCombo{};
 
-    // /  и
+    // 로컬/원격 렌더러 분리
     std::unique_ptr<ConsoleRenderer> m_LocalRenderer;
     std::unique_ptr<ConsoleRenderer> m_RemoteRenderer;
 };
@@ -0,0 +1,171 @@
+﻿#include "RollbackTimeline.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+
+using namespace Tetris;
+
+RollbackTimeline::RollbackTimeline(GameEngine& engine)
+    : m_Engine(engine)
+    , m_vFrames(MAX_FRAMES)
+{
+    Reset();
+}
+
+void RollbackTimeline::Reset()
+{
+    m_nHead = 0;
+    m_nCount = 0;
+    m_ConfirmedTick = m_Engine.GetTick();
+    m_nRollbackFrom = NO_ROLLBACK;
+    m_nCorrectFrom = 0;
+
+    // 입력 없는 기준 프레임 (첫 확정 입력이 과거 tick 이어도 되돌아갈 곳)
+    PushFrame(m_Engine.GetTick(), INPUT_NONE);
+}
+
+// =====================================================
+// 예측
+// =====================================================
+void RollbackTimeline::AddInput(uint64_t tick, uint8_t inputs)
+{
+    // 프레임은 tick 순서로 유지 (확정 / 보정된 tick 이전으로는 넣지 않음)
+    tick = std::max(tick, At(m_nCount - 1).tick);
+
+    if (m_nRollbackFrom == NO_ROLLBACK && tick >= m_Engine.GetTick())
+    {
+        AdvanceEngine(tick);
+        PushFrame(tick, inputs);
+        m_Engine.Step(inputs, 0);
+        return;
+    }
+
+    // 이미 지나간 tick (또는 되감기 대기 중) → 스냅샷은 Resimulate 에서 채움
+    PushFrame(tick, inputs);
+    MarkRollback(m_nCount - 2);
+}
+
+void RollbackTimeline::AdvanceTo(uint64_t tick)
+{
+    AdvanceEngine(tick);
+}
+
+// =====================================================
+// 확정 / 보정
+// =====================================================
+bool RollbackTimeline::CorrectInput(uint64_t tick, uint64_t appliedTick)
+{
+    for (size_t i = std::max<size_t>(m_nCorrectFrom, 1); i < m_nCount; ++i)
+    {
+        sFrame& frame = At(i);
+        if (frame.tick != tick)
+            continue;
+
+        frame.tick = appliedTick;
+
+        // 늦춰졌으면 자기 스냅샷 (원래 tick 직전) 에서 appliedTick 까지 중력만 더 진행하면 됨
+        if (appliedTick >= tick)
+        {
+            m_nCorrectFrom = i + 1;
+            MarkRollback(i);
+            return true;
+        }
+
+        // 앞당겨졌으면 (서버가 너무 앞선 tick 을 잘라냄) tick 순서 자리로 옮기고,
+        // 자기 스냅샷은 이미 원래 tick 까지 진행한 상태이므로 바로 앞 프레임에서 다시 시작
+        size_t j = i;
+        while (j > 1 && At(j - 1).tick > appliedTick)
+        {
+            std::swap(At(j), At(j - 1));
+            --j;
+        }
+
+        m_nCorrectFrom = j + 1;
+        MarkRollback(j - 1);
+        return true;
+    }
+
+    return false;
+}
+
+void RollbackTimeline::Confirm(uint64_t tick)
+{
+    m_ConfirmedTick = std::max(m_ConfirmedTick, tick);
+
+    // tick 이하의 마지막 프레임은 이후 과거 입력의 기준으로 남김
+    // 되감기 예약된 프레임부터는 Resimulate 전까지 남김
+    while (m_nCount > 1 && At(1).tick <= m_ConfirmedTick && m_nRollbackFrom != 0)
+        PopFront();
+}
+
+// =====================================================
+// 되감기
+// =====================================================
+size_t RollbackTimeline::Resimulate()
+{
+    if (m_nRollbackFrom == NO_ROLLBACK)
+        return 0;
+
+    const size_t nFrom = m_nRollbackFrom;
+    const uint64_t target = std::max(m_Engine.GetTick(), At(m_nCount - 1).tick);
+
+    m_nRollbackFrom = NO_ROLLBACK;
+    m_Engine = At(nFrom).before;
+
+    for (size_t i = nFrom; i < m_nCount; ++i)
+    {
+        sFrame& frame = At(i);
+
+        AdvanceEngine(frame.tick);
+        frame.before = m_Engine;
+        m_Engine.Step(frame.inputs, 0);
+    }
+
+    AdvanceEngine(target);
+
+    // 이미 재생한 효과음 / 연출은 다시 내지 않음
+    m_Engine.ClearEvents();
+
+    return m_nCount - nFrom;
+}
+
+void RollbackTimeline::PushFrame(uint64_t tick, uint8_t inputs)
+{
+    if (m_nCount == MAX_FRAMES)
+    {
+        // 확정이 오래 오지 않음 → 가장 오래된 입력을 확정으로 간주 (되감기 기준이면 먼저 반영)
+        TETRIS_ERROR("RollbackTimeline overflow!");
+        if (m_nRollbackFrom == 0)
+            Resimulate();
+
+        PopFront();
+    }
+
+    sFrame& frame = m_vFrames[(m_nHead + m_nCount) % MAX_FRAMES];
+    frame.tick = tick;
+    frame.inputs = inputs;
+    frame.before = m_Engine;
+    ++m_nCount;
+}
+
+void RollbackTimeline::PopFront()
+{
+    m_nHead = (m_nHead + 1) % MAX_FRAMES;
+    --m_nCount;
+
+    if (m_nCorrectFrom > 0)
+        --m_nCorrectFrom;
+
+    if (m_nRollbackFrom != NO_ROLLBACK)
+        --m_nRollbackFrom;
+}
+
+void RollbackTimeline::MarkRollback(size_t i)
+{
+    m_nRollbackFrom = std::min(m_nRollbackFrom, i);
+}
+
+void RollbackTimeline::AdvanceEngine(uint64_t tick)
+{
+    while (!m_Engine.IsGameOver() && m_Engine.GetTick() < tick)
+        m_Engine.Step(INPUT_NONE, static_cast<uint32_t>(std::min<uint64_t>(tick - m_Engine.GetTick(), UINT32_MAX)));
+}
@@ -0,0 +1,78 @@
+﻿#pragma once
+
+#include "../engine/GameEngine.h"
+#include <cstdint>
+#include <vector>
+
+// --------------------------------------------------------------------
+//  롤백 넷코드용 엔진 타임라인
+//
+//  확정되지 않은 입력을 "적용 직전 엔진 스냅샷"과 함께 링 버퍼에 보관한다.
+//  이미 지나간 tick 의 입력이 들어오거나 보낸 입력의 tick 이 바뀌면
+//  해당 프레임 스냅샷으로 되돌린 뒤 이후 입력을 다시 적용하며 원래 tick 까지 재시뮬레이션한다.
+//  입력 사이는 중력뿐이고 엔진은 Step 분할과 무관하므로 스냅샷은 tick 마다가 아니라 입력마다 둔다.
+//
+//  Local : 예측 입력 추가 → InputCorrection 으로 tick 수정, InputAck 로 확정
+//  Remote: 서버가 중계한 확정 입력만 추가, 그 이후는 입력 없음으로 예측 (중력만 진행)
+// --------------------------------------------------------------------
+class RollbackTimeline
+{
+public:
+    // 보관하는 입력 수 (넘치면 가장 오래된 입력부터 확정된 것으로 간주)
+    static constexpr size_t MAX_FRAMES = 128;
+
+    // engine 은 타임라인보다 오래 살아야 함 (타임라인은 상태를 되돌리기만 함)
+    explicit RollbackTimeline(GameEngine& engine);
+
+    // 엔진을 Reset 한 직후 호출: 현재 상태를 첫 기준 스냅샷으로
+    void Reset();
+
+    // tick 에 입력 적용. 엔진이 이미 tick 을 지났으면 되감기 예약 (Resimulate 에서 반영)
+    void AddInput(uint64_t tick, uint8_t inputs);
+
+    // 입력 없이 tick 까지 진행 (예측)
+    void AdvanceTo(uint64_t tick);
+
+    // tick 에 추가한 입력이 실제로는 appliedTick 에 적용됨 → 되감기 예약. 못 찾으면 false
+    // (appliedTick 은 tick 보다 늦을 수도, 서버가 미래 tick 을 잘라내 앞당겨졌을 수도 있음)
+    bool CorrectInput(uint64_t tick, uint64_t appliedTick);
+
+    // tick 까지의 입력이 확정됨 → 다시 되감을 일 없는 스냅샷 정리
+    void Confirm(uint64_t tick);
+
+    // 예약된 되감기 수행 후 되감기 전 tick 으로 복귀 (재생한 이벤트는 버림)
+    // 다시 적용한 입력 수 반환 (되감기가 없었으면 0)
+    size_t Resimulate();
+
+    const uint64_t GetConfirmedTick() const { return m_ConfirmedTick; }
+    const size_t GetFrameCount() const { return m_nCount; }
+
+private:
+    struct sFrame
+    {
+        uint64_t tick{ 0 };
+        uint8_t inputs{ 0 };
+        GameEngine before;      // tick 까지 진행 후, inputs 적용 직전 상태
+    };
+
+    sFrame& At(size_t i) { return m_vFrames[(m_nHead + i) % MAX_FRAMES]; }
+
+    void PushFrame(uint64_t tick, uint8_t inputs);
+    void PopFront();
+    void MarkRollback(size_t i);
+    void AdvanceEngine(uint64_t tick);
+
+private:
+    static constexpr size_t NO_ROLLBACK = SIZE_MAX;
+
+    GameEngine& m_Engine;
+
+    std::vector<sFrame> m_vFrames;      // MAX_FRAMES 고정, m_nHead 부터 m_nCount 개
+    size_t m_nHead{ 0 };
+    size_t m_nCount{ 0 };
+
+    uint64_t m_ConfirmedTick{ 0 };
+
+    size_t m_nRollbackFrom{ NO_ROLLBACK };  // 되감을 프레임 (m_nHead 기준)
+    size_t m_nCorrectFrom{ 0 };             // 보정은 보낸 순서대로 오므로 이 앞은 다시 찾지 않음
+};
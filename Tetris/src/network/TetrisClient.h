@@ -5,6 +5,8 @@
 class TetrisClient : public sp::net::client_interface<GameMsg>
 {
 public:
+	TetrisClient() { SetMaxMessageSize(NET_MAX_MESSAGE_SIZE); }
+
 	uint32_t GetPlayerID() { return m_PlayerID; }
 	void SetPlayerID(uint32_t id) { m_PlayerID = id; }
 
@@ -53,7 +53,7 @@ void GameOverState::Draw()
 	int current_y = panel_y;
 	
 
-	//    
+	// 게임 종료 문구 출력
 	
 	if (m_bIsVictory)
 	{
@@ -35,7 +35,7 @@ private:
 
 	Selector<> m_MenuSelector;
 
-	// ȭ ġ 
+	// 화면 배치 정보
 	int m_ScreenWidth, m_ScreenHeight, m_CenterScreenW, m_CenterScreenH;
 
 	bool m_bIsVictory;
@@ -13,16 +13,18 @@
 #include "../multiplay/MultiPlayLogic.h"
 #include "../multiplay/MultiPlayNetwork.h"
 #include "../multiplay/MultiPlayRenderer.h"
+#include "../bot/BotController.h"
 
 using namespace Tetris;
 
-MultiPlayState::MultiPlayState(Console& console, Keyboard& keyboard, SoundManager& soundManager, StateMachine& stateMachine, std::unique_ptr<TetrisClient> client, uint64_t bagSeed)
+MultiPlayState::MultiPlayState(Console& console, Keyboard& keyboard, SoundManager& soundManager, StateMachine& stateMachine, std::unique_ptr<TetrisClient> client, uint64_t bagSeed, NetSyncMode syncMode)
     : m_Console(console)
     , m_Keyboard(keyboard)
     , m_SoundManager(soundManager)
     , m_StateMachine(stateMachine)
     , m_Client(std::move(client))
     , m_bagSeed(bagSeed)
+    , m_SyncMode(syncMode)
 {
     m_GameOverTimer = std::make_unique<Timer>();
     m_SoftDropTimer = std::make_unique<Timer>();
@@ -38,12 +40,12 @@ void MultiPlayState::CheckGameOverTransition()
 
     if (m_Logic->IsGameOver(Side::Local))
     {
-        // Local й
+        // Local 패배
         m_bIsVictory = false;
     }
     else if (m_Logic->IsGameOver(Side::Remote))
     {
-        // Local ¸
+        // Local 승리
         m_bIsVictory = true;
     }
     else
@@ -81,17 +83,39 @@ void MultiPlayState::CheckGameOverTransition()
 
 void MultiPlayState::PlaySoundEffects()
 {
-    if (m_Logic->ShouldPlayFloorSE())
+    for (const auto& ev : m_Logic->GetLocalEvents())
     {
-        m_SoundManager.PlaySE_Force("floor");
-    }
+        switch (ev.type)
+        {
+        case EngineEventType::Move:
+            m_SoundManager.PlaySE_Force("move");
+            break;
 
-    if (m_Logic->ShouldPlayComboSE())
-    {
-        m_SoundManager.PlaySE_Force(m_Logic->GetComboString());
-    }
+        case EngineEventType::SoftDrop:
+            m_SoundManager.PlaySE_Force("move");
+            m_SoftDropTimer->Restart();
+            break;
+
+        case EngineEventType::HardDrop:
+            m_SoundManager.PlaySE_Force("harddrop");
+            break;
 
-    m_Logic->ClearSoundFlags();
+        case EngineEventType::Hold:
+            m_SoundManager.PlaySE_Force("hold");
+            break;
+
+        case EngineEventType::Lock:
+            m_SoundManager.PlaySE_Force("floor");
+            break;
+
+        case EngineEventType::Combo:
+            m_SoundManager.PlaySE_Force("combo_" + std::to_string(ev.value));
+            break;
+
+        default:
+            break;
+        }
+    }
 }
 
 void MultiPlayState::OnEnter()
@@ -101,9 +125,17 @@ void MultiPlayState::OnEnter()
 
     // --- Init Core Modules (Logic, Network, Renderer) ---
     m_Logic = std::make_unique<MultiPlayLogic>(m_bagSeed);
+
+    // 접속 정보가 없으면 오프라인 연습 (Remote = 봇)
+    if (!m_Client)
+        m_Logic->EnableRemoteBot(sBotConfig());
+    else if (m_SyncMode == NetSyncMode::Authoritative)
+        m_Logic->EnableRollback();
+
     m_Logic->Init();
 
-    m_Network = std::make_unique<MultiPlayNetwork>(std::move(m_Client), *m_Logic);
+    if (m_Client)
+        m_Network = std::make_unique<MultiPlayNetwork>(std::move(m_Client), *m_Logic);
 
     m_Renderer = std::make_unique<MultiPlayRenderer>(m_Console, *m_Logic);
     m_Renderer->InitLayout();
@@ -123,7 +155,7 @@ void MultiPlayState::OnExit()
 
 void MultiPlayState::Update()
 {
-    if (!m_Network->IsConnected())
+    if (m_Network && !m_Network->IsConnected())
     {
         TETRIS_LOG("Disconnected from server!");
         m_StateMachine.RequestPopDepth(1);
@@ -131,19 +163,24 @@ void MultiPlayState::Update()
     }
 
     // --- Receive Packets (ASIO -> MainThread) ---
-    m_Network->ProcessPackets();
+    if (m_Network)
+        m_Network->ProcessPackets();
 
     // --- Logic Step (Local Only) ---
-    m_Logic->Update();
+    m_Logic->Update(m_PendingInputs);
+    m_PendingInputs = INPUT_NONE;
 
 
     PlaySoundEffects();
     
 
     // --- Send Packets (MainThread -> ASIO) ---
-    m_Network->SyncToServer();
+    if (m_Network)
+        m_Network->SyncToServer();
+    else
+        m_Logic->ClearSyncFlags();
 
-    // --- Game Over ó ---
+    // --- Game Over 처리 ---
     CheckGameOverTransition();
 }
 
@@ -159,49 +196,35 @@ void MultiPlayState::ProcessInputs()
     if (m_Logic->IsGameOver(Side::Local))
         return;
 
+    // 실제 이동/회전은 Update 에서 Logic(엔진)이 처리
     if (m_Keyboard.IsKeyJustPressed(KEY_LEFT))
     {
-        if (m_Logic->TryMove(Side::Local, -1, 0))
-        {
-            m_SoundManager.PlaySE_Force("move");
-        }
+        m_PendingInputs |= INPUT_LEFT;
     }
     else if (m_Keyboard.IsKeyJustPressed(KEY_RIGHT))
     {
-        if (m_Logic->TryMove(Side::Local, +1, 0))
-        {
-            m_SoundManager.PlaySE_Force("move");
-        }
+        m_PendingInputs |= INPUT_RIGHT;
     }
     else if (m_Keyboard.IsKeyJustPressed(KEY_DOWN) || 
         (m_Keyboard.IsKeyHeld(KEY_DOWN) && m_SoftDropTimer->ElapsedMS() >= GameConfig::SoftDropIntervalMS))
     {
-        if (m_Logic->TrySoftDrop(Side::Local))
-        {
-            m_SoundManager.PlaySE_Force("move");
-            m_SoftDropTimer->Restart();
-        }
+        m_PendingInputs |= INPUT_SOFT_DROP;
     }
     else if (m_Keyboard.IsKeyJustPressed(KEY_UP))
     {
-        m_Logic->TryRotateCW(Side::Local);
+        m_PendingInputs |= INPUT_ROTATE_CW;
     }
     else if (m_Keyboard.IsKeyJustPressed(KEY_Z))
     {
-        m_Logic->TryRotateCCW(Side::Local);
+        m_PendingInputs |= INPUT_ROTATE_CCW;
     }
     else if (m_Keyboard.IsKeyJustPressed(KEY_SPACE))
     {
-        m_Logic->HardDrop(Side::Local);
-        m_SoundManager.PlaySE_Force("harddrop");
+        m_PendingInputs |= INPUT_HARD_DROP;
     }
     else if (m_Keyboard.IsKeyJustPressed(KEY_C))
     {
-        if (m_Logic->TryHold(Side::Local))
-        {
-            m_SoundManager.PlaySE_Force("hold");
-        }
-        
+        m_PendingInputs |= INPUT_HOLD;
     }
 }
 
@@ -2,8 +2,9 @@
 
 #include "IState.h"
 #include <memory>
+#include <cstdint>
 
-//  
+// 전방 선언
 class Console;
 class Keyboard;
 class SoundManager;
@@ -14,11 +15,14 @@ class MultiPlayNetwork;
 class MultiPlayRenderer;
 class TetrisClient;
 class Timer;
+enum class NetSyncMode : uint8_t;
 
+// client 가 nullptr 이면 서버 없이 Remote 측을 봇이 플레이하는 오프라인 연습 모드
+// syncMode 가 Authoritative 이면 입력만 서버로 보내고 Local 은 같은 엔진으로 예측
 class MultiPlayState final : public IState
 {
 public:
-    MultiPlayState(Console& console, Keyboard& keyboard, SoundManager& soundManager, StateMachine& stateMachine, std::unique_ptr<TetrisClient> client, uint64_t bagSeed);
+    MultiPlayState(Console& console, Keyboard& keyboard, SoundManager& soundManager, StateMachine& stateMachine, std::unique_ptr<TetrisClient> client, uint64_t bagSeed, NetSyncMode syncMode);
     ~MultiPlayState() override;
 
     void OnEnter() override;
@@ -47,6 +51,10 @@ private:
     bool m_bWaitingGameOverTransition{ false };
     bool m_bIsVictory{ false };
     uint64_t m_bagSeed = 0;
+    NetSyncMode m_SyncMode;
+
+    // ProcessInputs 에서 모은 입력 (Update 에서 Logic 에 전달)
+    uint8_t m_PendingInputs{ 0 };
 
     std::unique_ptr<TetrisClient> m_Client;
 
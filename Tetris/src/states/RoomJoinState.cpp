@@ -14,7 +14,7 @@ RoomJoinState::RoomJoinState(Console& console, Keyboard& keyboard, SoundManager&
     , m_StateMachine(stateMachine)
     , m_Client(std::make_unique<TetrisClient>())
 {
-    //  Connect õ (񵿱)
+    // 즉시 Connect 시도 (비동기)
     if (!m_Client->Connect("127.0.0.1", 60000))
     {
         TETRIS_ERROR("Client Connect Failed!");
@@ -28,17 +28,17 @@ void RoomJoinState::OnEnter()
     m_Console.ClearBuffer();
     m_sCurrentState = L"Connecting to server...";
 
-    // ŸӾƿ  
+    // 타임아웃 측정 시작
     m_ConnectStartTime = std::chrono::steady_clock::now();
 }
 
 void RoomJoinState::OnExit()
 {
-    //  Unregister û
+    // 안전한 Unregister 요청
     if (m_Client)
     {
         SendUnregister();
-        // TODO: send   ->  ʿ
+        // TODO: send가 보장되지 않음 -> 개선 필요
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
         m_Client->Disconnect();
     }
@@ -50,7 +50,7 @@ void RoomJoinState::Update()
 {
     HandlePackets();
 
-    // ʱ   ޾  ŸӾƿ ˻
+    // 초기 응답을 못 받았을 경우 타임아웃 검사
     if (!m_bServerResponded)
     {
         auto now = std::chrono::steady_clock::now();
@@ -64,7 +64,7 @@ void RoomJoinState::Update()
         }
     }
 
-    //  ̴ Update  ϰ ó
+    // 상태 전이는 Update 마지막에서만 안전하게 처리
     if (m_bTransitionQueued)
     {
         PerformTransitionToMultiPlay();
@@ -88,12 +88,12 @@ void RoomJoinState::TryJoinRoom()
 {
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Client_RequestRoomJoin;
-    m_Client->Send(msgOut);
+    m_Client->Send(std::move(msgOut));
 }
 
 void RoomJoinState::ScheduleTransitionToMultiPlay()
 {
-    m_bTransitionQueued = true;     //  PushState  ʰ ุ Ѵ.
+    m_bTransitionQueued = true;     // 즉시 PushState 하지 않고 예약만 한다.
 }
 
 void RoomJoinState::PerformTransitionToMultiPlay()
@@ -107,7 +107,8 @@ void RoomJoinState::PerformTransitionToMultiPlay()
             m_SoundManager,
             m_StateMachine,
             std::move(m_Client),
-            m_BagSeed
+            m_BagSeed,
+            m_SyncMode
         )
     );
 }
@@ -127,7 +128,7 @@ void RoomJoinState::HandlePackets()
             {
                 sp::net::message<GameMsg> pong;
                 pong.header.id = GameMsg::Client_Pong;
-                m_Client->Send(pong);
+                m_Client->Send(std::move(pong));
                 break;
             }
 
@@ -135,10 +136,10 @@ void RoomJoinState::HandlePackets()
             {
                 m_bServerResponded = true;
 
-                // Register û
+                // Register 요청
                 sp::net::message<GameMsg> msgOut;
                 msgOut.header.id = GameMsg::Client_RegisterWithServer;
-                m_Client->Send(msgOut);
+                m_Client->Send(std::move(msgOut));
 
                 m_sCurrentState = L"Connected to server!";
                 break;
@@ -146,7 +147,13 @@ void RoomJoinState::HandlePackets()
 
             case GameMsg::Client_AssignID:
             {
-                msgIn >> m_PlayerID;
+                sNetU32 id;
+                if (!ReadWire(msgIn, id))
+                {
+                    TETRIS_ERROR("Invalid Client_AssignID!");
+                    break;
+                }
+                m_PlayerID = id.Get();
                 m_Client->SetPlayerID(m_PlayerID);
                 TryJoinRoom();
                 break;
@@ -160,13 +167,23 @@ void RoomJoinState::HandlePackets()
 
             case GameMsg::Game_SendBagSeed:
             {
-                msgIn >> m_BagSeed;
+                sNetU64 seed;
+                if (!ReadWire(msgIn, seed))
+                {
+                    TETRIS_ERROR("Invalid Game_SendBagSeed!");
+                    break;
+                }
+                m_BagSeed = seed.Get();
                 break;
             }
 
             case GameMsg::Server_AllPlayersReady:
             {
-                //     
+                // body 가 없으면 (이전 서버) Relay
+                if (msgIn.body.size() >= sizeof(NetSyncMode))
+                    msgIn >> m_SyncMode;
+
+                // 즉시 전이 금지 → 예약
                 ScheduleTransitionToMultiPlay();
                 break;
             }
@@ -188,6 +205,6 @@ void RoomJoinState::SendUnregister()
 
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Client_UnregisterWithServer;
-    msgOut << m_Client->GetPlayerID();
-    m_Client->Send(msgOut);
+    msgOut << sNetU32(m_Client->GetPlayerID());
+    m_Client->Send(std::move(msgOut));
 }
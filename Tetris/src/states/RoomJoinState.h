@@ -26,12 +26,12 @@ public:
     bool Exit() override;
 
 private:
-    void TryJoinRoom();                 //  RoomJoin û
-    void HandlePackets();               // κ  ޽ ó
-    void SendUnregister();              //     Unregister
+    void TryJoinRoom();                 // 서버에 RoomJoin 요청
+    void HandlePackets();               // 서버로부터 온 메시지 처리
+    void SendUnregister();              // 상태 종료 시 서버에 Unregister
 
-    void ScheduleTransitionToMultiPlay();   // transition  
-    void PerformTransitionToMultiPlay();    //   
+    void ScheduleTransitionToMultiPlay();   // transition 지연 예약
+    void PerformTransitionToMultiPlay();    // 실제 상태 전이
 
 private:
     Console& m_Console;
@@ -41,21 +41,24 @@ private:
 
     std::unique_ptr<TetrisClient> m_Client;
 
-    //    ǥ
+    // 연결 과정 상태 표시
     std::wstring m_sCurrentState{};
 
-    // κ  ÷̾ ID
+    // 서버로부터 받은 플레이어 ID
     uint32_t m_PlayerID{ 0 };
 
-    // õ (Ƽ÷   ʿ)
+    // 시드 (멀티플레이 시작 시 필요)
     uint64_t m_BagSeed{ 0 };
 
-    //    ÷
+    // 서버가 AllPlayersReady 로 알려준 동기화 방식
+    NetSyncMode m_SyncMode{ NetSyncMode::Relay };
+
+    // 상태 전이 예약 플래그
     bool m_bTransitionQueued{ false };
 
-    //   ŸӾƿ
+    // 서버 응답 타임아웃용
     bool m_bServerResponded{ false };
     std::chrono::steady_clock::time_point m_ConnectStartTime{};
-    static constexpr int SERVER_RESPONSE_TIMEOUT_MS = 5000; // 5
+    static constexpr int SERVER_RESPONSE_TIMEOUT_MS = 5000; // 5초
 };
 
@@ -6,12 +6,10 @@
 #include "../utils/Logger.h"
 #include <cassert>
 
-#include "../Board.h"
-#include "../BagRandom.h"
-#include "../Score.h"
 #include "../utils/Timer.h"
-#include "../Tetromino.h"
 #include "../GameConfig.h"
+#include "../engine/GameEngine.h"
+#include "../engine/TickClock.h"
 
 #include "../ConsoleRenderer.h"
 #include "../common/TetrisTypes.h"
@@ -22,10 +20,8 @@ SinglePlayState::SinglePlayState(Console& console, Keyboard& keyboard, SoundMana
 	, m_Keyboard{ keyboard }
 	, m_SoundManager{ soundManager }
 	, m_StateMachine{ stateMachine }
-	, m_Board{ std::make_unique<Board>() }
-	, m_Bag{ std::make_unique<BagRandom>() }
-	, m_Score{ std::make_unique<Score>() }
-	, m_GravityTimer{ std::make_unique<Timer>() }
+	, m_Engine{ std::make_unique<GameEngine>() }
+	, m_Clock{ std::make_unique<SteadyTickClock>() }
 	, m_PlayTimer{ std::make_unique<Timer>() }
 	, m_ComboTimer{ std::make_unique<Timer>() }
 	, m_SoftDropTimer{ std::make_unique<Timer>() }
@@ -50,12 +46,13 @@ void SinglePlayState::OnEnter()
 
 	m_SoundManager.PlayBGM("play_bgm");
 
-	m_GravityTimer->Start();
 	m_PlayTimer->Start();
 	m_ComboTimer->Start();
 	m_SoftDropTimer->Start();
 
-	TrySpawnMino();
+	// 엔진은 생성 시 첫 미노까지 스폰된 상태
+	m_LastTick = m_Clock->Now();
+	HandleEngineEvents();
 }
 
 void SinglePlayState::OnExit()
@@ -81,26 +78,18 @@ void SinglePlayState::Update()
 		return;
 	}
 
-	// 중력 낙하
-	if (m_GravityTimer->ElapsedMS() >= GravityIntervalMS())
-	{
-		if (!TryMove(0, +1))
-		{
-			LockAndProceed();
-		}
-		else
-			m_GravityTimer->Restart();
-	}
+	// 지난 프레임 이후 경과한 tick 만큼 엔진 진행
+	const uint64_t now = m_Clock->Now();
+	const uint32_t elapsed = static_cast<uint32_t>(now - m_LastTick);
+	m_LastTick = now;
 
-	UpdatePreviewMinos();
+	m_Engine->Step(m_PendingInputs, elapsed);
+	m_PendingInputs = Tetris::INPUT_NONE;
 
-	// 고스트 미노 업데이트
-	UpdateGhostMino();
+	HandleEngineEvents();
 
 	if (!m_bGameReady)
 		m_bGameReady = true;
-
-	
 }
 
 void SinglePlayState::Draw()
@@ -110,10 +99,10 @@ void SinglePlayState::Draw()
 
 	m_Console.ClearBuffer();
 
-	m_Renderer->DrawBoard(*m_Board, m_CurMino.get(), m_GhostMino.get());
-	m_Renderer->DrawPreviewPanel(m_PreviewMinos);
-	m_Renderer->DrawHoldPanel(m_holdMinoType);
-	m_Renderer->DrawInfoPanel(*m_Score, *m_PlayTimer, m_totalPieces, m_LastCombo, m_bShowCombo, *m_ComboTimer);
+	m_Renderer->DrawBoard(m_Engine->GetBoard(), m_Engine->GetCurMino(), m_Engine->GetGhostMino());
+	m_Renderer->DrawPreviewPanel(m_Engine->GetPreview());
+	m_Renderer->DrawHoldPanel(m_Engine->GetHoldType());
+	m_Renderer->DrawInfoPanel(m_Engine->GetScore(), *m_PlayTimer, m_Engine->GetTotalPieces(), m_LastCombo, m_bShowCombo, *m_ComboTimer);
 }
 
 void SinglePlayState::ProcessInputs()
@@ -123,62 +112,39 @@ void SinglePlayState::ProcessInputs()
 		return;
 	}
 
+	// 실제 이동/회전은 Update 에서 엔진이 처리
 	if (m_Keyboard.IsKeyJustPressed(KEY_UP))
 	{
-		if (TryRotateCW())
-		{
-
-		}
+		m_PendingInputs |= Tetris::INPUT_ROTATE_CW;
 	}
 
 	if (m_Keyboard.IsKeyJustPressed(KEY_Z))
 	{
-		if (TryRotateCCW())
-		{
-		}
+		m_PendingInputs |= Tetris::INPUT_ROTATE_CCW;
 	}
 
 	else if (m_Keyboard.IsKeyJustPressed(KEY_DOWN) ||
 		(m_Keyboard.IsKeyHeld(KEY_DOWN) && m_SoftDropTimer->ElapsedMS() >= GameConfig::SoftDropIntervalMS))
 	{
-		if (TryMove(0, +1))
-		{
-			m_SoundManager.PlaySE_Force("move");
-			m_Score->AddSoftDrop(1);
-
-			m_SoftDropTimer->Restart();
-			m_GravityTimer->Restart();
-
-			m_SoundManager.PlaySE_Force("softdrop");
-		}
+		m_PendingInputs |= Tetris::INPUT_SOFT_DROP;
 	}
 
 	else if (m_Keyboard.IsKeyJustPressed(KEY_LEFT))
 	{
-		if (TryMove(-1, 0))
-		{
-			m_SoundManager.PlaySE_Force("move");
-		}
+		m_PendingInputs |= Tetris::INPUT_LEFT;
 	}
 
 	else if (m_Keyboard.IsKeyJustPressed(KEY_RIGHT))
 	{
-		if (TryMove(+1, 0))
-		{
-			m_SoundManager.PlaySE_Force("move");
-		}
+		m_PendingInputs |= Tetris::INPUT_RIGHT;
 	}
 	else if (m_Keyboard.IsKeyJustPressed(KEY_SPACE))
 	{
-		HardDrop();
+		m_PendingInputs |= Tetris::INPUT_HARD_DROP;
 	}
 	else if (m_Keyboard.IsKeyJustPressed(KEY_C))
 	{
-		if (TryHold())
-		{
-			m_GravityTimer->Restart();
-			m_SoundManager.PlaySE_Force("hold");
-		}
+		m_PendingInputs |= Tetris::INPUT_HOLD;
 	}
 
 }
@@ -188,211 +154,49 @@ bool SinglePlayState::Exit()
 	return false;
 }
 
-bool SinglePlayState::TrySpawnMino()
-{
-	// 다음 미노 스폰시 충돌 발생하는지 검사
-	Tetromino tempMino(m_Bag->Peek(0));
-	tempMino.SetPos(BOARD_WIDTH / 2, 1);
-
-	if (m_Board->IsCollide(tempMino, 0, 0))
-	{
-		OnGameOver();
-		return false;
-	}
-
-	m_CurMino = std::make_unique<Tetromino>(m_Bag->Next());
-
-	// 중앙 상단 스폰
-	m_CurMino->SetRotation(Tetris::Rotation::R0);
-	m_CurMino->SetPos(BOARD_WIDTH / 2, 1);
-
-	m_GravityTimer->Restart();
-
-	return true;
-}
-
-bool SinglePlayState::TryMove(int dx, int dy)
-{
-	if (!m_CurMino)
-	{
-		TETRIS_LOG("m_CurMino is not valid!");
-		return false;
-	}
-
-	if (m_Board->IsCollide(*m_CurMino, dx, dy))
-		return false;
-
-	m_CurMino->SetPos(m_CurMino->GetX() + dx, m_CurMino->GetY() + dy);
-	
-	return true;
-}
-
-bool SinglePlayState::TryRotateCW()
-{
-	if (!m_CurMino)
-	{
-		TETRIS_LOG("m_CurMino is not valid!");
-		return false;
-	}
-
-	const Tetris::Rotation prevRot = m_CurMino->GetRotation();
-	m_CurMino->RotateCW();
-
-	if (m_Board->IsCollide(*m_CurMino, 0, 0))
-	{
-		m_CurMino->SetRotation(prevRot);
-		return false;
-	}
-
-	return true;
-}
-
-bool SinglePlayState::TryRotateCCW()
-{
-	if (!m_CurMino)
-	{
-		TETRIS_LOG("m_CurMino is not valid!");
-		return false;
-	}
-
-	const Tetris::Rotation prevRot = m_CurMino->GetRotation();
-	m_CurMino->RotateCCW();
-
-	if (m_Board->IsCollide(*m_CurMino, 0, 0))
-	{
-		m_CurMino->SetRotation(prevRot);
-		return false;
-	}
-
-	return true;
-}
-
-bool SinglePlayState::TryHold()
+void SinglePlayState::HandleEngineEvents()
 {
-	// 한 턴에 한번씩만 홀드 가능
-	if (m_bHasHeldThisTurn)
-		return false;
-
-	assert(m_CurMino && "m_CurMino is not valid!");
-	
-	if (m_holdMinoType == Tetris::TetrominoType::None)
-	{
-		// 현재 미노타입을 홀드 타입으로 대입
-		m_holdMinoType = m_CurMino->GetType();
-
-		TrySpawnMino();
-	}
-	else
+	for (const auto& ev : m_Engine->GetEvents())
 	{
-		// 홀드 미노와 스왑시 충돌 발생하는지 검사
-		Tetromino tempMino(m_holdMinoType);
-		tempMino.SetPos(BOARD_WIDTH / 2, 1);
-
-		if (m_Board->IsCollide(tempMino, 0, 0))
+		switch (ev.type)
 		{
-			return false;
-		}
-
-		auto oldMinoType = m_CurMino->GetType();
-
-		// 현재 미노를 홀드 타입으로 교체 및 초기화
-		m_CurMino->SetType(m_holdMinoType);
-		m_CurMino->SetRotation(Tetris::Rotation::R0);
-		m_CurMino->SetPos(BOARD_WIDTH / 2, 1);
-
-		m_holdMinoType = oldMinoType;
-	}
-
-	// 고정되기 전까지 재홀드 불가
-	m_bHasHeldThisTurn = true;
-	return true;
-}
-
-void SinglePlayState::HardDrop()
-{
-	if (!m_CurMino)
-	{
-		TETRIS_LOG("m_CurMino is not valid!");
-		return;
-	}
-
-	int dropped = 0;
-	while (TryMove(0, +1))
-		++dropped;
-
-	if (dropped > 0)
-		m_Score->AddHardDrop(dropped);
+		case Tetris::EngineEventType::Move:
+			m_SoundManager.PlaySE_Force("move");
+			break;
 
-	LockAndProceed();
-	m_SoundManager.PlaySE_Force("harddrop");
-}
+		case Tetris::EngineEventType::SoftDrop:
+			m_SoundManager.PlaySE_Force("move");
+			m_SoftDropTimer->Restart();
+			m_SoundManager.PlaySE_Force("softdrop");
+			break;
 
-void SinglePlayState::LockAndProceed()
-{
-	if (!m_CurMino)
-	{
-		TETRIS_LOG("m_CurMino is not valid!");
-		return;
-	}
+		case Tetris::EngineEventType::HardDrop:
+			m_SoundManager.PlaySE_Force("harddrop");
+			break;
 
-	// 누적 피스갯수 증가
-	m_totalPieces++;
+		case Tetris::EngineEventType::Hold:
+			m_SoundManager.PlaySE_Force("hold");
+			break;
 
-	// 보드에 고정
-	m_Board->Lock(*m_CurMino);
+		case Tetris::EngineEventType::Lock:
+			m_SoundManager.PlaySE_Force("floor");
+			break;
 
-	// 라인 클리어
-	const int cleared = m_Board->ClearFullLines();
+		case Tetris::EngineEventType::Combo:
+			m_bShowCombo = true;
+			OnComboAchieved(ev.value);
+			break;
 
-	// 점수 기록
-	const bool isTSpin = false; // TODO: TSpin 판정 로직 구현필요
-	m_Score->OnLinesCleared(cleared, isTSpin);
+		case Tetris::EngineEventType::TopOut:
+			OnGameOver();
+			break;
 
-	// 이번 턴에 콤보 발생하였음
-	if (cleared > 0)
-	{
-		m_bShowCombo = true;
-		OnComboAchieved(m_Score->GetCombo());
+		default:
+			break;
+		}
 	}
 
-	// 새 턴 시작되므로 홀드 제한 해제
-	m_bHasHeldThisTurn = false;
-
-	// 새 미노 스폰
-	TrySpawnMino();
-
-	m_SoundManager.PlaySE_Force("floor");
-}
-
-
-int SinglePlayState::GravityIntervalMS() const
-{
-	// 레벨에 따라 가속 (ex. 700ms에서 레벨당 50ms 감소, 최소 80ms)
-	const int level = std::max(1, m_Score->GetLevel());
-	const int base = 700;
-	const int step = 50;
-	const int ms = base - (level - 1) * step;
-
-	return std::max(80, ms);
-}
-
-void SinglePlayState::UpdatePreviewMinos()
-{
-	for (int i = 0; i < Tetris::MINO_PREVIEW_COUNT; ++i)
-		m_PreviewMinos[i] = m_Bag->Peek(i);
-}
-
-void SinglePlayState::UpdateGhostMino()
-{
-	if (!m_CurMino)
-		return;
-
-	// 현재 미노를 복사
-	m_GhostMino = std::make_unique<Tetromino>(*m_CurMino);
-
-	// 가능한 아래로 이동
-	while (!m_Board->IsCollide(*m_GhostMino, 0, +1))
-		m_GhostMino->SetPos(m_GhostMino->GetX(), m_GhostMino->GetY() + 1);
+	m_Engine->ClearEvents();
 }
 
 void SinglePlayState::OnComboAchieved(int comboCount)
@@ -405,10 +209,6 @@ void SinglePlayState::OnGameOver()
 {
 	m_bGameOver = true;
 
-	m_CurMino = nullptr;
-	m_GhostMino = nullptr;
-
-	m_GravityTimer->Stop();
 	m_PlayTimer->Pause();
 	m_ComboTimer->Stop();
 	m_SoftDropTimer->Stop();
@@ -423,12 +223,8 @@ void SinglePlayState::OnGameOver()
 
 void SinglePlayState::Shutdown()
 {
-	m_CurMino.reset();
-	m_GhostMino.reset();
-
-	m_Score.reset();
-	m_Bag.reset();
-	m_Board.reset();
+	m_Engine.reset();
+	m_Clock.reset();
 
 	m_Console.ClearBuffer();
 }
\ No newline at end of file
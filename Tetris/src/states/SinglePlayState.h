@@ -10,13 +10,11 @@ class Keyboard;
 class SoundManager;
 class StateMachine;
 
-class Board;
-class BagRandom;
-class Score;
 class Timer;
 class ConsoleRenderer;
 
-class Tetromino;
+class GameEngine;
+class ITickClock;
 
 class SinglePlayState final : public IState
 {
@@ -34,23 +32,13 @@ public:
 
 private:
 
-	//  
-	bool TrySpawnMino();
-	bool TryMove(int dx, int dy);
-	bool TryRotateCW();
-	bool TryRotateCCW();
-	bool TryHold();
-	void HardDrop();
-	void LockAndProceed();
-	int GravityIntervalMS() const;
-
-	void UpdatePreviewMinos();
-	void UpdateGhostMino();
+	// 엔진 이벤트 → 사운드/연출
+	void HandleEngineEvents();
 
 	void OnComboAchieved(int comboCount);
 	void OnGameOver();
 
-	//  ڿ ʱȭ
+	// 사용한 자원 초기화
 	void Shutdown();
 
 private:
@@ -59,17 +47,20 @@ private:
 	SoundManager& m_SoundManager;
 	StateMachine& m_StateMachine;
 
-	std::unique_ptr<Board> m_Board;
-	std::unique_ptr<BagRandom> m_Bag;
-	std::unique_ptr<Score> m_Score;
+	// 게임 규칙은 엔진이 담당, 이 State 는 입력/사운드/렌더링만 연결
+	std::unique_ptr<GameEngine> m_Engine;
+	std::unique_ptr<ITickClock> m_Clock;
+	uint64_t m_LastTick{ 0 };
+
+	// ProcessInputs 에서 모은 입력 (Update 에서 엔진에 전달)
+	uint8_t m_PendingInputs{ 0 };
 
-	std::unique_ptr<Timer> m_GravityTimer;
 	std::unique_ptr<Timer> m_PlayTimer;
 	std::unique_ptr<Timer> m_ComboTimer;
 	std::unique_ptr<Timer> m_SoftDropTimer;
 	std::unique_ptr<Timer> m_GameOverTimer;
 
-	// ȭ/ ġ 
+	// 화면/보드 배치 정보
 	int m_ScreenWidth, m_ScreenHeight, m_CenterScreenW, m_CenterScreenH;
 	int m_BoardLeft, m_BoardTop;
 
@@ -79,23 +70,7 @@ private:
 	bool m_bGameOver{ false };
 	bool m_bWaitingGameOverTransition{ false };
 
-	//  ̳
-	std::unique_ptr<Tetromino> m_CurMino{ nullptr };
-
-	// ̸ ̳
-	std::array<Tetris::TetrominoType, Tetris::MINO_PREVIEW_COUNT> m_PreviewMinos{};
-
-	// Ʈ ̳
-	std::unique_ptr<Tetromino> m_GhostMino{ nullptr };
-
-	// Ȧ ̳ Ÿ
-	Tetris::TetrominoType m_holdMinoType{ Tetris::TetrominoType::None };
-	bool m_bHasHeldThisTurn{ false };
-
-	//  ǽ 
-	int m_totalPieces{ 0 };
-
-	// ޺   
+	// 콤보 출력을 위한 변수
 	int m_LastCombo{ 0 };
 	bool m_bShowCombo{ false };
 };
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "SinglePlayState.h"
 #include "RoomJoinState.h"
 #include "../utils/Logger.h"
+#include "../utils/Random.h"
+#include "../network/TetrisClient.h"
 
 // Test
 #include "MultiPlayState.h"
@@ -17,7 +19,7 @@ TitleState::TitleState(Console& console, Keyboard& keyboard, SoundManager& sound
 	, m_Keyboard{ keyboard }
 	, m_SoundManager{ soundManager }
 	, m_StateMachine{ stateMachine }
-	, m_MenuSelector{ console, keyboard, {L"Single Play", L"Multi Play", L"Exit"}, SelectorParams{console.GetHalfWidth(), console.GetHalfHeight()}}
+	, m_MenuSelector{ console, keyboard, {L"Single Play", L"Multi Play", L"Practice (vs Bot)", L"Exit"}, SelectorParams{console.GetHalfWidth(), console.GetHalfHeight()}}
 	, m_ScreenWidth{ console.GetScreenWidth() }
 	, m_ScreenHeight{ console.GetScreenHeight() }
 	, m_CenterScreenW{ console.GetHalfWidth() }
@@ -87,7 +89,14 @@ void TitleState::OnMenuSelect(int index, std::vector<std::wstring> data)
 	case 1: // Multi Play (1 vs 1)
 		m_StateMachine.PushState(std::make_unique<RoomJoinState>(m_Console, m_Keyboard, m_SoundManager, m_StateMachine));
 		break;
-	case 2:
+	case 2: // Practice (Local vs Bot, 서버 없이 MultiPlayState 사용)
+	{
+		Random random;
+		m_StateMachine.PushState(std::make_unique<MultiPlayState>(m_Console, m_Keyboard, m_SoundManager, m_StateMachine,
+			nullptr, random.Range<uint64_t>(1, UINT64_MAX), NetSyncMode::Relay));
+		break;
+	}
+	case 3:
 		// Game Exit
 		break;
 	}
@@ -3,24 +3,34 @@
 #include "Logger.h"
 #include <chrono>
 #include <ctime>
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <iostream>
 #include "Colors.h"
 
 void Logger::Log(const std::string_view message)
 {
+#ifdef _WIN32
 	HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
 	SetConsoleTextAttribute(hConsole, GREEN);
+#endif
 	std::cout << "LOG: " << CurrentDate() << " - " << message << "\n";
+#ifdef _WIN32
 	SetConsoleTextAttribute(hConsole, WHITE);
+#endif
 }
 
 void Logger::Error(const std::string& message, const char* file, const char* function, int line)
 {
+#ifdef _WIN32
 	HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
 	SetConsoleTextAttribute(hConsole, RED);
+#endif
 	std::cout << "ERROR: " << CurrentDate() << " - " << message << "\nFILE: " << file << "\nFUNC: " << function << "\nLINE: " << line << "\n\n";
+#ifdef _WIN32
 	SetConsoleTextAttribute(hConsole, WHITE);
+#endif
 }
 
 std::string Logger::CurrentDate()
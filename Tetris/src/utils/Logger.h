@@ -5,6 +5,13 @@
 #define TETRIS_LOG(x) Logger::Log(x);
 #define TETRIS_ERROR(x) Logger::Error(x, __FILE__, __FUNCTION__, __LINE__);
 
+// 엔진 코드는 Windows 이외 환경(시뮬레이터 등)에서도 빌드되므로 분기
+#if defined(_MSC_VER)
+#define TETRIS_DEBUGBREAK() __debugbreak()
+#else
+#define TETRIS_DEBUGBREAK() ((void)0)
+#endif
+
 class Logger
 {
 public:
@@ -10,7 +10,7 @@ public:
 	Random();
 	~Random() = default;
 
-	//   ȯ, : [min..max]
+	// 정수형 랜덤값 반환, 범위: [min..max]
 	template <typename T>
 	T Range(T min, T max)
 	{
@@ -19,7 +19,7 @@ public:
 		return dist(m_Engine);
 	}
 
-	// Ǽ  ȯ, : [min..max)
+	// 실수형 랜덤값 반환, 범위: [min..max)
 	template <typename T>
 	T RangeReal(T min, T max)
 	{
@@ -28,13 +28,13 @@ public:
 		return dist(m_Engine);
 	}
 
-	// Ȯ ׽Ʈ (0~1 )
+	// 확률 테스트 (0~1 난수)
 	bool Chance(double probability);
 	
-	//  Ҹ (50% Ȯ)
+	// 랜덤 불리언 (50% 확률)
 	bool Bool();
 
-	// õ 缳
+	// 시드 재설정
 	void Reseed(uint64_t seed = 0);
 
 	std::mt19937_64& Engine() noexcept { return m_Engine; }
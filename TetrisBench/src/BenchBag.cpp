@@ -0,0 +1,50 @@
+﻿#include "BenchSuite.h"
+#include "BagRandom.h"
+#include <memory>
+
+void RegisterBagBenches(BenchSuite& suite)
+{
+	auto bag = std::make_shared<BagRandom>(1);
+
+	suite.Add("bag/next", 8192, [bag](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		int sum = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+			sum += static_cast<int>(bag->Next());
+
+		KeepAlive(sum);
+		return n;
+	});
+
+	// 게임에서는 스폰마다 미리보기 5개를 다시 읽음
+	suite.Add("bag/peek_preview", 8192, [bag](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		int sum = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+			sum += static_cast<int>(bag->Peek(i % Tetris::MINO_PREVIEW_COUNT));
+
+		KeepAlive(sum);
+		return n;
+	});
+
+	// Next 한 번 + 미리보기 갱신 (스폰 한 번에 해당)
+	suite.Add("bag/spawn_cycle", 4096, [bag](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		int sum = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			sum += static_cast<int>(bag->Next());
+			for (size_t p = 0; p < Tetris::MINO_PREVIEW_COUNT; ++p)
+				sum += static_cast<int>(bag->Peek(p));
+		}
+
+		KeepAlive(sum);
+		return n;
+	});
+}
@@ -0,0 +1,140 @@
+﻿#include "BenchSuite.h"
+#include "BenchFixtures.h"
+#include "engine/MoveGenerator.h"
+#include <memory>
+
+namespace
+{
+	constexpr size_t FIXTURE_COUNT = 256;
+
+	struct sBoardFixture
+	{
+		std::vector<Board> stacks;
+		std::vector<Board> clearable;
+		std::vector<Tetromino> probes;
+
+		// 각 스택에서 하드 드롭 위치로 옮긴 미노 (Lock 입력)
+		std::vector<Tetromino> landed;
+	};
+
+	std::shared_ptr<sBoardFixture> MakeFixture()
+	{
+		auto fx = std::make_shared<sBoardFixture>();
+		fx->stacks = BenchFixtures::MakeRealisticStacks(FIXTURE_COUNT, 1);
+		fx->clearable = BenchFixtures::MakeClearableStacks(FIXTURE_COUNT, 2);
+		fx->probes = BenchFixtures::MakeProbes(FIXTURE_COUNT * 4, 3);
+
+		fx->landed.reserve(FIXTURE_COUNT);
+		for (size_t i = 0; i < FIXTURE_COUNT; ++i)
+		{
+			Tetromino t(static_cast<Tetris::TetrominoType>(1 + i % Tetris::MINO_TYPE_COUNT));
+			t.SetPos(BOARD_WIDTH / 2, 1);
+			t.SetPos(t.GetX(), t.GetY() + fx->stacks[i].DropDistance(t));
+			fx->landed.push_back(t);
+		}
+
+		return fx;
+	}
+}
+
+void RegisterBoardBenches(BenchSuite& suite)
+{
+	auto fx = MakeFixture();
+
+	suite.Add("board/is_collide", 4096, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		int hits = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			const Board& board = fx->stacks[i % FIXTURE_COUNT];
+			const Tetromino& probe = fx->probes[i % fx->probes.size()];
+			hits += board.IsCollide(probe, 0, 1) ? 1 : 0;
+		}
+
+		KeepAlive(hits);
+		return n;
+	});
+
+	suite.Add("board/drop_distance", 4096, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		int total = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			Tetromino t = fx->probes[i % fx->probes.size()];
+			t.SetPos(t.GetX(), 1);
+			total += fx->stacks[i % FIXTURE_COUNT].DropDistance(t);
+		}
+
+		KeepAlive(total);
+		return n;
+	});
+
+	// Lock / ClearFullLines 는 보드를 바꾸므로 복사본에 수행
+	// (복사 비용은 board/copy 로 따로 측정)
+	suite.Add("board/copy", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			Board board = fx->stacks[i % FIXTURE_COUNT];
+			KeepAlive(board);
+		}
+
+		return n;
+	});
+
+	suite.Add("board/lock", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			Board board = fx->stacks[i % FIXTURE_COUNT];
+			board.Lock(fx->landed[i % FIXTURE_COUNT]);
+			KeepAlive(board);
+		}
+
+		return n;
+	});
+
+	suite.Add("board/clear_full_lines", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		int cleared = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			Board board = fx->clearable[i % FIXTURE_COUNT];
+			cleared += board.ClearFullLines();
+			KeepAlive(board);
+		}
+
+		KeepAlive(cleared);
+		return n;
+	});
+
+	// 스택 하나에서 도달 가능한 모든 배치 + 입력 경로 생성 (봇의 미노당 기본 비용)
+	suite.Add("placement/generate", 64, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		MoveGenerator generator;
+		std::vector<sPlacement> placements;
+		placements.reserve(128);
+		int total = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			placements.clear();
+			total += generator.Generate(fx->stacks[i % FIXTURE_COUNT],
+				static_cast<Tetris::TetrominoType>(1 + i % Tetris::MINO_TYPE_COUNT), placements);
+		}
+
+		KeepAlive(total);
+		return n;
+	});
+}
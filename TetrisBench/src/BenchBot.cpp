@@ -0,0 +1,108 @@
+﻿#include "BenchSuite.h"
+#include "BenchFixtures.h"
+#include "bot/BoardBatch.h"
+#include "bot/BoardEvaluator.h"
+#include "engine/MoveGenerator.h"
+#include <memory>
+#include <string>
+
+namespace
+{
+	constexpr size_t FIXTURE_COUNT = 64;
+
+	// 스택 하나와 그 위에서 생성한 배치 후보 (봇이 한 미노에 평가하는 묶음)
+	struct sBotFixture
+	{
+		std::vector<Board> stacks;
+		std::vector<std::vector<sPlacement>> candidates;
+	};
+
+	std::shared_ptr<sBotFixture> MakeFixture()
+	{
+		auto fx = std::make_shared<sBotFixture>();
+		fx->stacks = BenchFixtures::MakeRealisticStacks(FIXTURE_COUNT, 7);
+
+		MoveGenerator generator;
+		fx->candidates.resize(FIXTURE_COUNT);
+		for (size_t i = 0; i < FIXTURE_COUNT; ++i)
+			generator.Generate(fx->stacks[i], static_cast<Tetris::TetrominoType>(1 + i % Tetris::MINO_TYPE_COUNT), fx->candidates[i]);
+
+		return fx;
+	}
+}
+
+void RegisterBotBenches(BenchSuite& suite)
+{
+	auto fx = MakeFixture();
+	const sEvalWeights weights{};
+
+	// 기존 방식: 후보마다 Board 복사 + Lock + ClearFullLines + Extract
+	suite.Add("bot/eval_board_copy", 8, [fx, weights](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		uint64_t ops = 0;
+		double sum = 0.0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			const size_t s = i % FIXTURE_COUNT;
+			for (const auto& placement : fx->candidates[s])
+			{
+				Tetromino mino(placement.type);
+				mino.SetPos(placement.x, placement.y);
+				mino.SetRotation(placement.rot);
+
+				Board after = fx->stacks[s];
+				after.Lock(mino);
+				const int cleared = after.ClearFullLines();
+
+				sum += BoardEvaluator::Score(BoardEvaluator::Extract(after), cleared, weights);
+				++ops;
+			}
+		}
+
+		KeepAlive(sum);
+		return ops;
+	});
+
+	// BoardBatch + 커널별 (연산 단위는 후보 1개)
+	for (BatchKernel kernel : { BatchKernel::Scalar, BatchKernel::SSE2, BatchKernel::AVX2 })
+	{
+		if (!BoardBatchKernel::IsSupported(kernel))
+			continue;
+
+		const std::string name = std::string("bot/eval_batch_") + BoardBatchKernel::GetName(kernel);
+		auto batch = std::make_shared<BoardBatch>();
+		auto features = std::make_shared<sBatchFeatures>();
+
+		suite.Add(name, 8, [fx, weights, kernel, batch, features](BenchContext& ctx) -> uint64_t
+		{
+			const uint32_t n = ctx.GetBatch();
+			uint64_t ops = 0;
+			double sum = 0.0;
+
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				const size_t s = i % FIXTURE_COUNT;
+				const auto& candidates = fx->candidates[s];
+
+				for (size_t begin = 0; begin < candidates.size(); begin += BoardBatch::LANES)
+				{
+					batch->Reset(fx->stacks[s]);
+					for (size_t c = begin; c < candidates.size() && !batch->IsFull(); ++c)
+						batch->Push(candidates[c]);
+
+					BoardBatchKernel::Evaluate(*batch, *features, kernel);
+
+					for (int lane = 0; lane < batch->GetCount(); ++lane)
+						sum += BoardEvaluator::Score(features->Get(lane), batch->GetLinesCleared(lane), weights);
+
+					ops += static_cast<uint64_t>(batch->GetCount());
+				}
+			}
+
+			KeepAlive(sum);
+			return ops;
+		});
+	}
+}
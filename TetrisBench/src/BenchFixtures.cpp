@@ -0,0 +1,85 @@
+﻿#include "BenchFixtures.h"
+#include "engine/GameEngine.h"
+#include "engine/EngineTypes.h"
+#include <cstdlib>
+#include <random>
+
+using namespace Tetris;
+
+namespace
+{
+	// 임의 회전/이동 후 하드 드롭 (tetris_sim 의 random 정책과 같은 방식)
+	void DropRandomPiece(GameEngine& engine, std::mt19937_64& rng)
+	{
+		const int rotations = static_cast<int>(rng() % Tetris::ROTATION_COUNT);
+		const int shift = static_cast<int>(rng() % BOARD_WIDTH) - BOARD_WIDTH / 2;
+
+		for (int i = 0; i < rotations; ++i)
+			engine.Step(INPUT_ROTATE_CW, 0);
+
+		for (int i = 0; i < std::abs(shift); ++i)
+			engine.Step(shift < 0 ? INPUT_LEFT : INPUT_RIGHT, 0);
+
+		engine.Step(INPUT_HARD_DROP, 0);
+		engine.ClearEvents();
+	}
+}
+
+std::vector<Board> BenchFixtures::MakeRealisticStacks(size_t count, uint64_t seed)
+{
+	std::vector<Board> boards;
+	boards.reserve(count);
+
+	std::mt19937_64 rng(seed);
+	GameEngine engine(seed);
+
+	while (boards.size() < count)
+	{
+		engine.Reset(seed + boards.size() + 1);
+
+		// 8 ~ 40 피스 (거의 빈 보드부터 절반 이상 쌓인 보드까지)
+		const int pieces = 8 + static_cast<int>(rng() % 33);
+		for (int i = 0; i < pieces && !engine.IsGameOver(); ++i)
+			DropRandomPiece(engine, rng);
+
+		if (!engine.IsGameOver())
+			boards.push_back(engine.GetBoard());
+	}
+
+	return boards;
+}
+
+std::vector<Board> BenchFixtures::MakeClearableStacks(size_t count, uint64_t seed)
+{
+	std::vector<Board> boards = MakeRealisticStacks(count, seed);
+	std::mt19937_64 rng(seed ^ 0x5bd1e995ull);
+
+	for (auto& board : boards)
+	{
+		// 하단 1 ~ 4 줄 가득 채우기 (싱글 ~ 테트리스)
+		const int lines = 1 + static_cast<int>(rng() % 4);
+		for (int y = board.GetHeight() - lines; y < board.GetHeight(); ++y)
+			for (int x = 0; x < board.GetWidth(); ++x)
+				if (board.Get(x, y) == 0)
+					board.Set(x, y, static_cast<int>(TetrominoType::I));
+	}
+
+	return boards;
+}
+
+std::vector<Tetromino> BenchFixtures::MakeProbes(size_t count, uint64_t seed)
+{
+	std::vector<Tetromino> probes;
+	probes.reserve(count);
+
+	std::mt19937_64 rng(seed);
+	for (size_t i = 0; i < count; ++i)
+	{
+		Tetromino t(static_cast<TetrominoType>(1 + rng() % Tetris::MINO_TYPE_COUNT));
+		t.SetRotation(static_cast<Rotation>(rng() % Tetris::ROTATION_COUNT));
+		t.SetPos(static_cast<int>(rng() % BOARD_WIDTH), 1 + static_cast<int>(rng() % (BOARD_HEIGHT - 2)));
+		probes.push_back(t);
+	}
+
+	return probes;
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Board.h"
+#include "Tetromino.h"
+
+namespace BenchFixtures
+{
+	// 실제 플레이와 비슷한 스택 (GameEngine 으로 임의 배치를 반복해 생성)
+	// 높이가 다양하고 구멍/오버행이 섞인 보드들
+	std::vector<Board> MakeRealisticStacks(size_t count, uint64_t seed);
+
+	// 스택 보드의 하단 몇 줄을 가득 채워 라인 클리어가 발생하도록 만든 보드
+	std::vector<Board> MakeClearableStacks(size_t count, uint64_t seed);
+
+	// 보드 위 임의 위치/회전의 미노 (충돌 검사 입력용)
+	std::vector<Tetromino> MakeProbes(size_t count, uint64_t seed);
+}
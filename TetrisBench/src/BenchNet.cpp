@@ -0,0 +1,212 @@
+﻿#include "BenchSuite.h"
+#include "common/PacketProtocol.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+	constexpr int BROADCAST_CLIENTS = 4;
+
+	// 루프백 서버: 수신 메시지 수만 셈
+	class LoopbackServer : public sp::net::server_interface<GameMsg>
+	{
+	public:
+		LoopbackServer() : sp::net::server_interface<GameMsg>(0) {}
+
+		const uint16_t GetPort() const { return m_asioAcceptor.local_endpoint().port(); }
+		const int GetValidatedCount() const { return m_nValidated.load(); }
+
+		void Broadcast(const sp::net::message<GameMsg>& msg) { MessageAllClients(msg); }
+
+		uint64_t nReceived{ 0 };
+
+	protected:
+		bool OnClientConnect(std::shared_ptr<sp::net::connection<GameMsg>>) override { return true; }
+		void OnClientValidated(std::shared_ptr<sp::net::connection<GameMsg>>) override { ++m_nValidated; }
+
+		void OnMessage(std::shared_ptr<sp::net::connection<GameMsg>>, sp::net::message<GameMsg>&) override
+		{
+			++nReceived;
+		}
+
+	private:
+		std::atomic<int> m_nValidated{ 0 };
+	};
+
+	// 연결 목록 조회 / 제거만 측정 (소켓은 열기만 하고 접속하지 않음, io_context 도 실행하지 않음)
+	class RegistryServer : public sp::net::server_interface<GameMsg>
+	{
+	public:
+		RegistryServer() : sp::net::server_interface<GameMsg>(0) {}
+
+		std::shared_ptr<sp::net::connection<GameMsg>> MakeConnection(uint32_t id)
+		{
+			auto conn = std::make_shared<sp::net::connection<GameMsg>>(
+				sp::net::connection<GameMsg>::owner::server, asio::ip::tcp::socket(m_asioContext, asio::ip::tcp::v4()), m_qMessagesIn);
+			conn->ConnectToClient(id);
+			return conn;
+		}
+
+		using sp::net::server_interface<GameMsg>::AddConnection;
+		using sp::net::server_interface<GameMsg>::RemoveConnection;
+		using sp::net::server_interface<GameMsg>::GetConnectionByID;
+	};
+
+	struct sNetFixture
+	{
+		LoopbackServer server;
+		std::vector<std::unique_ptr<sp::net::client_interface<GameMsg>>> clients;
+	};
+
+	// 첫 실행 시에만 소켓을 열어 다른 벤치마크만 돌릴 때는 네트워크를 쓰지 않음
+	sNetFixture& GetFixture()
+	{
+		static std::unique_ptr<sNetFixture> s_Fixture;
+		if (s_Fixture)
+			return *s_Fixture;
+
+		s_Fixture = std::make_unique<sNetFixture>();
+		s_Fixture->server.Start();
+
+		for (int c = 0; c < BROADCAST_CLIENTS; ++c)
+		{
+			s_Fixture->clients.push_back(std::make_unique<sp::net::client_interface<GameMsg>>());
+			s_Fixture->clients.back()->Connect("127.0.0.1", s_Fixture->server.GetPort());
+		}
+
+		// OnClientValidated 는 Update 에서 호출됨
+		while (s_Fixture->server.GetValidatedCount() < BROADCAST_CLIENTS)
+		{
+			s_Fixture->server.Update();
+			std::this_thread::yield();
+		}
+
+		return *s_Fixture;
+	}
+
+	sp::net::message<GameMsg> MakeMinoMessage(uint32_t i)
+	{
+		sMinoState state;
+		state.type = static_cast<int32_t>(i % 7) + 1;
+		state.x = static_cast<int32_t>(i % NET_BOARD_WIDTH);
+
+		sp::net::message<GameMsg> msg;
+		msg.header.id = GameMsg::Game_CurMinoState;
+		msg << PackMinoState(state);
+		return msg;
+	}
+
+	// 모든 행이 찬 보드 키프레임과 같은 크기의 Game_BoardDelta
+	sp::net::message<GameMsg> MakeBoardKeyframeMessage(uint32_t i)
+	{
+		sp::net::message<GameMsg> msg;
+		msg.header.id = GameMsg::Game_BoardDelta;
+
+		for (uint8_t y = 0; y < NET_BOARD_HEIGHT; ++y)
+		{
+			sBoardDeltaRow row;
+			row.y = y;
+			row.cells.fill(static_cast<uint8_t>(i));
+			msg << row;
+		}
+
+		sBoardDeltaHeader header;
+		header.version.Set(i);
+		header.flags = NET_BOARD_DELTA_KEYFRAME;
+		header.rowCount = static_cast<uint8_t>(NET_BOARD_HEIGHT);
+		msg << header;
+		return msg;
+	}
+}
+
+void RegisterNetBenches(BenchSuite& suite)
+{
+	// 클라이언트 한 명이 작은 패킷을 연속 송신 → 서버가 모두 꺼낼 때까지 (메시지당 시간)
+	suite.Add("net/loopback_client_burst", 512, [](BenchContext& ctx) -> uint64_t
+	{
+		sNetFixture& fx = GetFixture();
+		const uint32_t n = ctx.GetBatch();
+
+		fx.server.nReceived = 0;
+		for (uint32_t i = 0; i < n; ++i)
+			fx.clients[0]->Send(MakeMinoMessage(i));
+
+		while (fx.server.nReceived < n)
+		{
+			fx.server.Update(n);
+			std::this_thread::yield();
+		}
+
+		return n;
+	});
+
+	// 연결 수가 늘어도 id 조회 / 끊긴 연결 제거 비용이 일정한지 확인
+	for (const uint32_t nConnections : { 64u, 4096u })
+	{
+		auto pServer = std::make_shared<RegistryServer>();
+		for (uint32_t i = 0; i < nConnections; ++i)
+			pServer->AddConnection(pServer->MakeConnection(10000 + i));
+
+		suite.Add("net/registry_lookup_" + std::to_string(nConnections) + "c", 4096, [pServer, nConnections](BenchContext& ctx) -> uint64_t
+		{
+			const uint32_t n = ctx.GetBatch();
+			uint32_t id = 10000;
+
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				id = 10000 + (id * 2654435761u + i) % nConnections;
+				KeepAlive(pServer->GetConnectionByID(id));
+			}
+
+			return n;
+		});
+
+		// 임의의 연결 하나를 제거하고 같은 id 로 다시 추가
+		suite.Add("net/registry_churn_" + std::to_string(nConnections) + "c", 1024, [pServer, nConnections](BenchContext& ctx) -> uint64_t
+		{
+			const uint32_t n = ctx.GetBatch();
+
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				const uint32_t id = 10000 + (i * 2654435761u) % nConnections;
+				auto conn = pServer->GetConnectionByID(id);
+
+				pServer->RemoveConnection(conn);
+				pServer->AddConnection(std::move(conn));
+			}
+
+			return n;
+		});
+	}
+
+	// 서버 → 모든 클라이언트 브로드캐스트 (수신 측 메시지 기준)
+	// mino: 4바이트 body, board: 델타 키프레임 최대 크기 body
+	for (const bool bBoard : { false, true })
+	{
+		const std::string name = bBoard ? "net/loopback_broadcast_board_4c" : "net/loopback_broadcast_4c";
+
+		suite.Add(name, 256, [bBoard](BenchContext& ctx) -> uint64_t
+		{
+			sNetFixture& fx = GetFixture();
+			const uint32_t n = ctx.GetBatch();
+
+			for (uint32_t i = 0; i < n; ++i)
+				fx.server.Broadcast(bBoard ? MakeBoardKeyframeMessage(i) : MakeMinoMessage(i));
+
+			for (auto& client : fx.clients)
+			{
+				for (uint32_t i = 0; i < n; ++i)
+				{
+					while (client->Incoming().empty())
+						std::this_thread::yield();
+
+					client->Incoming().pop_front();
+				}
+			}
+
+			return static_cast<uint64_t>(n) * BROADCAST_CLIENTS;
+		});
+	}
+}
@@ -0,0 +1,183 @@
+﻿#include "BenchSuite.h"
+#include "BenchFixtures.h"
+#include "common/PacketProtocol.h"
+#include "multiplay/MultiPlayLogic.h"
+#include "multiplay/BoardSync.h"
+#include "engine/GameEngine.h"
+#include <cstdlib>
+#include <memory>
+
+namespace
+{
+	constexpr size_t FIXTURE_COUNT = 64;
+
+	struct sProtocolFixture
+	{
+		std::vector<Board> stacks;
+		std::vector<sBoardState> packets;
+		std::vector<sBoardStateWire> wirePackets;
+
+		// 연속된 고정 직후 보드와 그때의 라인 클리어 (델타 인코딩 입력)
+		std::vector<Board> lockSequence;
+		std::vector<sClearedLines> lockCleared;
+
+		std::unique_ptr<MultiPlayLogic> logic;
+
+		// 직렬화 버퍼 재사용 측정용
+		sp::net::message<GameMsg> reused;
+	};
+}
+
+void RegisterProtocolBenches(BenchSuite& suite)
+{
+	auto fx = std::make_shared<sProtocolFixture>();
+	fx->stacks = BenchFixtures::MakeRealisticStacks(FIXTURE_COUNT, 11);
+
+	for (const auto& board : fx->stacks)
+	{
+		fx->packets.push_back(board.ToPacket());
+		fx->wirePackets.push_back(PackBoardState(fx->packets.back()));
+	}
+
+	// 좌우 임의 이동 후 하드 드롭을 반복하며 고정마다 보드 기록
+	{
+		GameEngine engine(21);
+		uint32_t state = 21;
+		while (fx->lockSequence.size() < FIXTURE_COUNT * 4)
+		{
+			if (engine.IsGameOver())
+				engine.Reset(state);
+
+			state = state * 1664525u + 1013904223u;
+			const int shift = static_cast<int>((state >> 16) % 9) - 4;
+			for (int s = 0; s < std::abs(shift); ++s)
+				engine.Step(shift < 0 ? Tetris::INPUT_LEFT : Tetris::INPUT_RIGHT, 0);
+
+			engine.Step(Tetris::INPUT_HARD_DROP, 0);
+			engine.ClearEvents();
+
+			fx->lockSequence.push_back(engine.GetBoard());
+			fx->lockCleared.push_back(engine.GetLastCleared());
+		}
+	}
+
+	fx->logic = std::make_unique<MultiPlayLogic>(1);
+	fx->logic->Init();
+
+	suite.Add("board/to_packet", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			sBoardState pkt = fx->stacks[i % FIXTURE_COUNT].ToPacket();
+			KeepAlive(pkt);
+		}
+
+		return n;
+	});
+
+	// 보드 적용 + 상대 고스트 재계산
+	suite.Add("logic/apply_enemy_board_state", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+
+		for (uint32_t i = 0; i < n; ++i)
+			fx->logic->ApplyEnemyBoardState(fx->packets[i % FIXTURE_COUNT]);
+
+		KeepAlive(*fx->logic->GetBoard(Tetris::PlayerSide::Remote));
+		return n;
+	});
+
+	// 송신 경로: 메시지를 새로 만들어 보드 상태를 넣음 (body 할당 포함)
+	suite.Add("message/board_push_fresh", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			sp::net::message<GameMsg> msg;
+			msg.header.id = GameMsg::Game_BoardState;
+			msg << PackBoardState(fx->packets[i % FIXTURE_COUNT]);
+			KeepAlive(msg);
+		}
+
+		return n;
+	});
+
+	// << / >> 자체 비용 (body 용량 재사용)
+	suite.Add("message/board_roundtrip", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		sBoardStateWire wire;
+		sBoardState out;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			fx->reused << fx->wirePackets[i % FIXTURE_COUNT];
+			fx->reused >> wire;
+			UnpackBoardState(wire, out);
+		}
+
+		KeepAlive(out);
+		return n;
+	});
+
+	suite.Add("message/mino_roundtrip", 8192, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		sMinoState in{};
+		sMinoStateWire wire;
+		sMinoState out{};
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			in.x = static_cast<int32_t>(i % NET_BOARD_WIDTH);
+			fx->reused << PackMinoState(in);
+			fx->reused >> wire;
+			UnpackMinoState(wire, out);
+		}
+
+		KeepAlive(out);
+		return n;
+	});
+
+	// 고정 1회분 델타 인코딩 (KEYFRAME_INTERVAL 마다 키프레임 포함)
+	suite.Add("message/board_delta_encode", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		BoardDeltaEncoder encoder;
+		size_t bytes = 0;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			const size_t idx = i % fx->lockSequence.size();
+
+			sp::net::message<GameMsg> msg;
+			encoder.Encode(fx->lockSequence[idx], &fx->lockCleared[idx], msg);
+			bytes += msg.size();
+		}
+
+		KeepAlive(bytes);
+		return n;
+	});
+
+	suite.Add("message/board_delta_roundtrip", 1024, [fx](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		BoardDeltaEncoder encoder;
+		BoardDeltaDecoder decoder;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			const size_t idx = i % fx->lockSequence.size();
+
+			sp::net::message<GameMsg> msg;
+			encoder.Encode(fx->lockSequence[idx], &fx->lockCleared[idx], msg);
+			decoder.Apply(msg);
+		}
+
+		KeepAlive(decoder.GetState());
+		return n;
+	});
+}
@@ -0,0 +1,109 @@
+﻿#include "BenchSuite.h"
+#include "common/PacketProtocol.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	uint64_t NowNs()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+	}
+
+	// 서버 수신 큐와 같은 형태: 여러 ASIO 스레드가 push, 메인 스레드 하나가 꺼냄
+	// 메시지 body 에 push 시각을 넣어 push → pop 지연을 기록
+	// bDrain: server_interface::Update 처럼 drain_into 로 일괄 수거, 아니면 empty / pop_front 반복
+	uint64_t RunContended(BenchContext& ctx, unsigned producers, bool bDrain)
+	{
+		sp::net::tsqueue<sp::net::owned_message<GameMsg>> queue;
+		std::vector<sp::net::owned_message<GameMsg>> drained;
+
+		const uint32_t perProducer = ctx.GetBatch() / producers;
+		const uint64_t total = static_cast<uint64_t>(perProducer) * producers;
+
+		std::atomic<bool> bGo{ false };
+		std::vector<std::thread> threads;
+		threads.reserve(producers);
+
+		for (unsigned p = 0; p < producers; ++p)
+		{
+			threads.emplace_back([&queue, &bGo, perProducer]
+			{
+				while (!bGo.load(std::memory_order_acquire))
+					std::this_thread::yield();
+
+				for (uint32_t i = 0; i < perProducer; ++i)
+				{
+					sp::net::owned_message<GameMsg> msg;
+					msg.msg.header.id = GameMsg::Game_CurMinoState;
+					msg.msg << NowNs();
+					queue.push_back(msg);
+				}
+			});
+		}
+
+		auto& latencies = ctx.GetLatencies();
+		latencies.reserve(latencies.size() + total);
+
+		bGo.store(true, std::memory_order_release);
+
+		uint64_t popped = 0;
+		while (popped < total)
+		{
+			if (queue.empty())
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			if (bDrain)
+			{
+				queue.drain_into(drained);
+
+				const uint64_t now = NowNs();
+				for (auto& msg : drained)
+				{
+					uint64_t stamp = 0;
+					msg.msg >> stamp;
+					ctx.RecordLatency(now - stamp);
+				}
+
+				popped += drained.size();
+				drained.clear();
+				continue;
+			}
+
+			auto msg = queue.pop_front();
+
+			uint64_t stamp = 0;
+			msg.msg >> stamp;
+			ctx.RecordLatency(NowNs() - stamp);
+			++popped;
+		}
+
+		for (auto& t : threads)
+			t.join();
+
+		return total;
+	}
+}
+
+void RegisterQueueBenches(BenchSuite& suite)
+{
+	for (unsigned producers : { 1u, 2u, 4u })
+	{
+		suite.Add("tsqueue/mpsc_" + std::to_string(producers) + "p", 16384, [producers](BenchContext& ctx) -> uint64_t
+		{
+			return RunContended(ctx, producers, false);
+		});
+
+		suite.Add("tsqueue/drain_" + std::to_string(producers) + "p", 16384, [producers](BenchContext& ctx) -> uint64_t
+		{
+			return RunContended(ctx, producers, true);
+		});
+	}
+}
@@ -0,0 +1,121 @@
+﻿#include "BenchSuite.h"
+#include "engine/GameEngine.h"
+#include "multiplay/RollbackTimeline.h"
+#include <memory>
+#include <random>
+
+using namespace Tetris;
+
+namespace
+{
+	constexpr uint64_t FRAME_TICKS = 16;
+
+	// 사람 입력 비슷한 분포 (이동 / 회전 위주, 가끔 하드 드롭)
+	uint8_t RandomInput(std::mt19937_64& rng)
+	{
+		switch (rng() % 8)
+		{
+		case 0: case 1: return INPUT_LEFT;
+		case 2: case 3: return INPUT_RIGHT;
+		case 4: case 5: return INPUT_ROTATE_CW;
+		case 6: return INPUT_SOFT_DROP;
+		default: return INPUT_HARD_DROP;
+		}
+	}
+
+	struct sTimelineState
+	{
+		GameEngine engine{ 1 };
+		RollbackTimeline timeline{ engine };
+		std::mt19937_64 rng{ 3 };
+		uint64_t seed{ 1 };
+		uint64_t now{ 0 };
+
+		void RestartIfOver()
+		{
+			if (!engine.IsGameOver())
+				return;
+
+			engine.Reset(++seed);
+			timeline.Reset();
+			now = 0;
+		}
+	};
+}
+
+void RegisterRollbackBenches(BenchSuite& suite)
+{
+	// 스냅샷 한 번 (입력마다 한 번)
+	{
+		auto src = std::make_shared<GameEngine>(1);
+		auto dst = std::make_shared<GameEngine>(2);
+
+		suite.Add("rollback/snapshot_copy", 1024, [src, dst](BenchContext& ctx) -> uint64_t
+		{
+			const uint32_t n = ctx.GetBatch();
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				*dst = *src;
+				KeepAlive(dst->GetTick());
+			}
+
+			return n;
+		});
+	}
+
+	// Remote: 매 프레임 150ms 전 확정 입력이 도착 → 되감아서 현재까지 재시뮬레이션 (연산 단위 = 프레임 한 번)
+	{
+		auto state = std::make_shared<sTimelineState>();
+
+		suite.Add("rollback/remote_150ms", 256, [state](BenchContext& ctx) -> uint64_t
+		{
+			const uint32_t n = ctx.GetBatch();
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				state->RestartIfOver();
+
+				state->now += FRAME_TICKS;
+				state->timeline.AdvanceTo(state->now);
+
+				if (state->now > 150)
+				{
+					state->timeline.AddInput(state->now - 150, RandomInput(state->rng));
+					state->timeline.Confirm(state->now - 150);
+				}
+
+				KeepAlive(state->timeline.Resimulate());
+			}
+
+			return n;
+		});
+	}
+
+	// Local: 확정 전 입력 8개 중 가장 오래된 것이 보정됨 → 그 스냅샷부터 8개 재적용 (연산 단위 = 보정 한 번)
+	{
+		auto state = std::make_shared<sTimelineState>();
+
+		suite.Add("rollback/local_correction_8", 256, [state](BenchContext& ctx) -> uint64_t
+		{
+			const uint32_t n = ctx.GetBatch();
+			for (uint32_t i = 0; i < n; ++i)
+			{
+				state->RestartIfOver();
+
+				state->now += FRAME_TICKS;
+				state->timeline.AdvanceTo(state->now);
+				state->timeline.AddInput(state->now, RandomInput(state->rng));
+
+				const uint64_t oldest = state->now - 7 * FRAME_TICKS;
+				if (state->now > 8 * FRAME_TICKS)
+				{
+					state->timeline.Confirm(oldest - 1);
+					state->timeline.CorrectInput(oldest, oldest + 5);
+				}
+
+				KeepAlive(state->timeline.Resimulate());
+			}
+
+			return n;
+		});
+	}
+}
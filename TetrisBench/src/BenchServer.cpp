@@ -0,0 +1,103 @@
+﻿#include "BenchSuite.h"
+#include "../../TetrisServer/src/room/PlayerSim.h"
+#include "engine/EngineTypes.h"
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+using namespace Tetris;
+
+namespace
+{
+	constexpr uint32_t STREAM_SECONDS = 120;
+	constexpr uint32_t SYNC_INTERVAL_TICKS = 100;	// Room::AUTH_TICK_MS
+
+	struct sTimedInput
+	{
+		uint32_t tick;
+		uint8_t inputs;
+	};
+
+	// 사람 플레이와 비슷한 입력 흐름 (초당 약 6회 입력, 1.5초마다 하드 드롭)
+	std::shared_ptr<std::vector<sTimedInput>> MakeInputStream(uint64_t seed)
+	{
+		auto stream = std::make_shared<std::vector<sTimedInput>>();
+		std::mt19937_64 rng(seed);
+
+		for (uint32_t tick = 0; tick < STREAM_SECONDS * 1000; tick += 1500)
+		{
+			const int rotations = static_cast<int>(rng() % Tetris::ROTATION_COUNT);
+			const int shift = static_cast<int>(rng() % BOARD_WIDTH) - BOARD_WIDTH / 2;
+
+			uint32_t at = tick;
+			for (int i = 0; i < rotations; ++i)
+				stream->push_back({ at += 120, INPUT_ROTATE_CW });
+
+			for (int i = 0; i < std::abs(shift); ++i)
+				stream->push_back({ at += 90, static_cast<uint8_t>(shift < 0 ? INPUT_LEFT : INPUT_RIGHT) });
+
+			stream->push_back({ at + 150, INPUT_HARD_DROP });
+		}
+
+		return stream;
+	}
+
+	// 서버 워커가 한 방에서 하는 일 그대로: 입력 적용 → 확인 진행 → 주기마다 상대 중계 / 본인 확정 메시지
+	struct sSimState
+	{
+		std::unique_ptr<PlayerSim> sim;
+		size_t cursor{ 0 };
+		uint32_t tick{ 0 };
+		uint64_t seed{ 1 };
+		std::vector<sp::net::message<GameMsg>> vOut;
+		sp::net::message<GameMsg> ack;
+	};
+
+	void RestartIfNeeded(sSimState& state)
+	{
+		if (state.sim && !state.sim->IsGameOver() && state.tick < STREAM_SECONDS * 1000)
+			return;
+
+		state.sim = std::make_unique<PlayerSim>(state.seed++);
+		state.cursor = 0;
+		state.tick = 0;
+	}
+}
+
+void RegisterServerBenches(BenchSuite& suite)
+{
+	auto stream = MakeInputStream(11);
+	auto state = std::make_shared<sSimState>();
+
+	// 연산 단위 = 플레이어 1명의 1초 → ops/s 가 코어 하나로 감당하는 동시 플레이어 수
+	suite.Add("server/player_sim_second", 4, [stream, state](BenchContext& ctx) -> uint64_t
+	{
+		const uint32_t n = ctx.GetBatch();
+		const auto& events = *stream;
+
+		for (uint32_t i = 0; i < n; ++i)
+		{
+			RestartIfNeeded(*state);
+
+			for (uint32_t end = state->tick + 1000; state->tick < end; )
+			{
+				state->tick += SYNC_INTERVAL_TICKS;
+
+				while (state->cursor < events.size() && events[state->cursor].tick <= state->tick)
+				{
+					const sTimedInput& ev = events[state->cursor++];
+					state->sim->ApplyInput(ev.tick, ev.inputs, state->tick);
+				}
+
+				state->sim->Confirm(state->tick, state->tick);
+				state->sim->BuildSyncMessages(state->vOut, state->ack);
+
+				KeepAlive(state->vOut.size());
+				state->vOut.clear();
+				state->ack.body.clear();
+			}
+		}
+
+		return n;
+	});
+}
@@ -0,0 +1,189 @@
+﻿#define _CRT_SECURE_NO_WARNINGS
+
+#include "BenchSuite.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	double Percentile(const std::vector<double>& sorted, double p)
+	{
+		if (sorted.empty())
+			return 0.0;
+
+		const size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+		return sorted[std::min(idx, sorted.size() - 1)];
+	}
+
+	std::string CurrentTimestamp()
+	{
+		std::time_t now = std::time(nullptr);
+
+		char buf[32]{};
+		std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+		return buf;
+	}
+
+	const char* CompilerName()
+	{
+#if defined(_MSC_VER)
+		return "msvc";
+#elif defined(__clang__)
+		return "clang";
+#elif defined(__GNUC__)
+		return "gcc";
+#else
+		return "unknown";
+#endif
+	}
+}
+
+void BenchSuite::Add(const std::string& name, uint32_t batch, BenchFn fn)
+{
+	m_Entries.push_back({ name, std::max(1u, batch), std::move(fn) });
+}
+
+void BenchSuite::Run(const sBenchOptions& options)
+{
+	m_Results.clear();
+
+	for (const auto& entry : m_Entries)
+	{
+		if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos)
+			continue;
+
+		m_Results.push_back(RunOne(entry, options));
+
+		const auto& r = m_Results.back();
+		std::printf("%-40s %12.1f ns/op (p99 %.1f)\n", r.name.c_str(), r.meanNs, r.p99Ns);
+		std::fflush(stdout);
+	}
+}
+
+sBenchResult BenchSuite::RunOne(const sBenchEntry& entry, const sBenchOptions& options) const
+{
+	using Clock = std::chrono::steady_clock;
+
+	// 워밍업 (캐시/분기 예측기 안정화)
+	for (uint32_t i = 0; i < options.warmupSamples; ++i)
+	{
+		BenchContext ctx(entry.batch);
+		entry.fn(ctx);
+	}
+
+	std::vector<double> perOp;
+	std::vector<uint64_t> latencies;
+
+	sBenchResult result;
+	result.name = entry.name;
+
+	const double minTimeNs = options.minTimeMS * 1e6;
+
+	while (result.samples < options.maxSamples &&
+		(result.samples < options.minSamples || result.totalNs < minTimeNs))
+	{
+		BenchContext ctx(entry.batch);
+
+		const auto start = Clock::now();
+		const uint64_t ops = entry.fn(ctx);
+		const auto end = Clock::now();
+
+		const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+		result.totalNs += ns;
+		result.ops += ops;
+		++result.samples;
+
+		if (ops > 0)
+			perOp.push_back(ns / static_cast<double>(ops));
+
+		auto& recorded = ctx.GetLatencies();
+		latencies.insert(latencies.end(), recorded.begin(), recorded.end());
+	}
+
+	result.opsPerSec = result.totalNs > 0.0 ? static_cast<double>(result.ops) * 1e9 / result.totalNs : 0.0;
+
+	// 직접 기록한 지연이 있으면 그 분포를, 없으면 샘플별 연산당 시간 분포를 사용
+	std::vector<double> dist;
+	if (!latencies.empty())
+	{
+		result.unit = "latency";
+		dist.assign(latencies.begin(), latencies.end());
+	}
+	else
+	{
+		dist = std::move(perOp);
+	}
+
+	if (!dist.empty())
+	{
+		std::sort(dist.begin(), dist.end());
+
+		double sum = 0.0;
+		for (double v : dist)
+			sum += v;
+
+		result.meanNs = sum / static_cast<double>(dist.size());
+		result.minNs = dist.front();
+		result.maxNs = dist.back();
+		result.p50Ns = Percentile(dist, 0.50);
+		result.p90Ns = Percentile(dist, 0.90);
+		result.p99Ns = Percentile(dist, 0.99);
+	}
+
+	return result;
+}
+
+void BenchSuite::PrintTable() const
+{
+	std::printf("\n%-40s %8s %14s %10s %10s %10s %10s\n", "benchmark", "unit", "ops/s", "mean ns", "p50 ns", "p90 ns", "p99 ns");
+	for (const auto& r : m_Results)
+	{
+		std::printf("%-40s %8s %14.0f %10.1f %10.1f %10.1f %10.1f\n",
+			r.name.c_str(), r.unit.c_str(), r.opsPerSec, r.meanNs, r.p50Ns, r.p90Ns, r.p99Ns);
+	}
+}
+
+bool BenchSuite::WriteJson(const std::string& path) const
+{
+	std::FILE* f = std::fopen(path.c_str(), "w");
+	if (!f)
+		return false;
+
+	std::fprintf(f, "{\n  \"timestamp\": \"%s\",\n  \"compiler\": \"%s\",\n  \"results\": [\n", CurrentTimestamp().c_str(), CompilerName());
+
+	for (size_t i = 0; i < m_Results.size(); ++i)
+	{
+		const auto& r = m_Results[i];
+		std::fprintf(f,
+			"    {\"name\": \"%s\", \"unit\": \"%s\", \"ops\": %llu, \"samples\": %u, \"ops_per_sec\": %.1f, "
+			"\"mean_ns\": %.2f, \"min_ns\": %.2f, \"p50_ns\": %.2f, \"p90_ns\": %.2f, \"p99_ns\": %.2f, \"max_ns\": %.2f}%s\n",
+			r.name.c_str(), r.unit.c_str(), static_cast<unsigned long long>(r.ops), r.samples, r.opsPerSec,
+			r.meanNs, r.minNs, r.p50Ns, r.p90Ns, r.p99Ns, r.maxNs,
+			(i + 1 < m_Results.size()) ? "," : "");
+	}
+
+	std::fputs("  ]\n}\n", f);
+	std::fclose(f);
+	return true;
+}
+
+bool BenchSuite::WriteCsv(const std::string& path) const
+{
+	std::FILE* f = std::fopen(path.c_str(), "w");
+	if (!f)
+		return false;
+
+	std::fputs("name,unit,ops,samples,ops_per_sec,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,max_ns\n", f);
+	for (const auto& r : m_Results)
+	{
+		std::fprintf(f, "%s,%s,%llu,%u,%.1f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+			r.name.c_str(), r.unit.c_str(), static_cast<unsigned long long>(r.ops), r.samples, r.opsPerSec,
+			r.meanNs, r.minNs, r.p50Ns, r.p90Ns, r.p99Ns, r.maxNs);
+	}
+
+	std::fclose(f);
+	return true;
+}
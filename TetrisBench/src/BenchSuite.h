@@ -0,0 +1,114 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------------
+//  컴파일러가 벤치마크 대상 연산을 제거하지 못하도록 값을 소비
+// --------------------------------------------------------------------
+template <typename T>
+inline void KeepAlive(const T& value)
+{
+#if defined(_MSC_VER)
+	static volatile const void* s_Sink;
+	s_Sink = &value;
+#else
+	asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+// 한 샘플 실행 중 벤치마크 함수가 사용하는 정보
+class BenchContext
+{
+public:
+	explicit BenchContext(uint32_t batch) : m_Batch{ batch } {}
+
+	// 이번 샘플에서 수행할 연산 수
+	const uint32_t GetBatch() const { return m_Batch; }
+
+	// 연산 단위 지연을 직접 측정하는 벤치마크용 (ex. 큐 push → pop)
+	void RecordLatency(uint64_t ns) { m_Latencies.push_back(ns); }
+
+	std::vector<uint64_t>& GetLatencies() { return m_Latencies; }
+
+private:
+	uint32_t m_Batch{ 1 };
+	std::vector<uint64_t> m_Latencies;
+};
+
+// 한 샘플을 실행하고 실제 수행한 연산 수를 반환
+using BenchFn = std::function<uint64_t(BenchContext&)>;
+
+struct sBenchOptions
+{
+	double minTimeMS{ 200.0 };		// 벤치마크당 최소 측정 시간
+	uint32_t minSamples{ 30 };
+	uint32_t maxSamples{ 100000 };
+	uint32_t warmupSamples{ 3 };
+	std::string filter{};			// 이름에 포함된 벤치마크만 실행
+};
+
+struct sBenchResult
+{
+	std::string name;
+	std::string unit{ "op" };		// 지연 분포 기준 (op: 연산당 시간, latency: 직접 기록한 지연)
+
+	uint64_t ops{ 0 };
+	uint32_t samples{ 0 };
+	double totalNs{ 0.0 };
+
+	double opsPerSec{ 0.0 };
+
+	// 연산당 ns 분포
+	double meanNs{ 0.0 };
+	double minNs{ 0.0 };
+	double p50Ns{ 0.0 };
+	double p90Ns{ 0.0 };
+	double p99Ns{ 0.0 };
+	double maxNs{ 0.0 };
+};
+
+// --------------------------------------------------------------------
+//  등록된 벤치마크를 순서대로 실행하고 처리량/지연 분포를 수집
+// --------------------------------------------------------------------
+class BenchSuite
+{
+public:
+	void Add(const std::string& name, uint32_t batch, BenchFn fn);
+
+	void Run(const sBenchOptions& options);
+
+	const std::vector<sBenchResult>& GetResults() const { return m_Results; }
+
+	void PrintTable() const;
+
+	// 회귀 추적용 JSON / CSV
+	bool WriteJson(const std::string& path) const;
+	bool WriteCsv(const std::string& path) const;
+
+private:
+	struct sBenchEntry
+	{
+		std::string name;
+		uint32_t batch{ 1 };
+		BenchFn fn;
+	};
+
+	sBenchResult RunOne(const sBenchEntry& entry, const sBenchOptions& options) const;
+
+private:
+	std::vector<sBenchEntry> m_Entries;
+	std::vector<sBenchResult> m_Results;
+};
+
+// 벤치마크 등록 (각 Bench*.cpp)
+void RegisterBoardBenches(BenchSuite& suite);
+void RegisterBagBenches(BenchSuite& suite);
+void RegisterProtocolBenches(BenchSuite& suite);
+void RegisterQueueBenches(BenchSuite& suite);
+void RegisterBotBenches(BenchSuite& suite);
+void RegisterNetBenches(BenchSuite& suite);
+void RegisterServerBenches(BenchSuite& suite);
+void RegisterRollbackBenches(BenchSuite& suite);
@@ -0,0 +1,79 @@
+﻿#include "BenchSuite.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	void PrintUsage()
+	{
+		std::printf(
+			"usage: tetris_bench [options]\n"
+			"  --filter TEXT    run only benchmarks whose name contains TEXT\n"
+			"  --min-time MS    minimum measuring time per benchmark (default 200)\n"
+			"  --json PATH      write results as JSON\n"
+			"  --csv PATH       write results as CSV\n");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	sBenchOptions options;
+	const char* jsonPath = nullptr;
+	const char* csvPath = nullptr;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+		if (!value)
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		if (std::strcmp(arg, "--filter") == 0)
+			options.filter = value;
+		else if (std::strcmp(arg, "--min-time") == 0)
+			options.minTimeMS = std::atof(value);
+		else if (std::strcmp(arg, "--json") == 0)
+			jsonPath = value;
+		else if (std::strcmp(arg, "--csv") == 0)
+			csvPath = value;
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		++i;
+	}
+
+	BenchSuite suite;
+	RegisterBoardBenches(suite);
+	RegisterBagBenches(suite);
+	RegisterProtocolBenches(suite);
+	RegisterQueueBenches(suite);
+	RegisterBotBenches(suite);
+	RegisterNetBenches(suite);
+	RegisterServerBenches(suite);
+	RegisterRollbackBenches(suite);
+
+	suite.Run(options);
+	suite.PrintTable();
+
+	if (jsonPath && !suite.WriteJson(jsonPath))
+	{
+		std::fprintf(stderr, "failed to write %s\n", jsonPath);
+		return 1;
+	}
+
+	if (csvPath && !suite.WriteCsv(csvPath))
+	{
+		std::fprintf(stderr, "failed to write %s\n", csvPath);
+		return 1;
+	}
+
+	return 0;
+}
@@ -1,139 +1,90 @@
 #include "TetrisServer.h"
 #include <iostream>
-#include <random>
+#include <algorithm>
 
-TetrisServer::TetrisServer(uint16_t nPort)
-    : sp::net::server_interface<GameMsg>(nPort)
+TetrisServer::TetrisServer(uint16_t nPort, size_t nIoThreads, size_t nRoomWorkers, NetSyncMode syncMode)
+    : sp::net::server_interface<GameMsg>(nPort, nIoThreads)
+    , m_RoomManager(nRoomWorkers, syncMode)
 {
     m_LastPingTime = std::chrono::steady_clock::now();
+    m_RoomManager.Start();
 }
 
-bool TetrisServer::OnClientConnect(std::shared_ptr<sp::net::connection<GameMsg>>)
+TetrisServer::~TetrisServer()
 {
-    return true;    //  
+    // 워커가 연결에 Send 하지 않도록 I/O 스레드보다 먼저 정지
+    m_RoomManager.Stop();
 }
 
-void TetrisServer::OnClientDisconnect(std::shared_ptr<sp::net::connection<GameMsg>> client)
+bool TetrisServer::OnClientConnect(std::shared_ptr<sp::net::connection<GameMsg>> client)
 {
-    if (!client)
-        return;
-
-    uint32_t id = client->GetID();
-
-    //   ̺Ʈ    
-    {
-        std::lock_guard<std::mutex> lock(m_EventMutex);
-        m_EventQueue.push_back({ ServerEventType::ClientDisconnected, id });
-    }
+    client->SetMaxMessageSize(NET_MAX_MESSAGE_SIZE);
+    return true;    // 접속 허용
 }
 
-void TetrisServer::OnMessage(std::shared_ptr<sp::net::connection<GameMsg>> client,
-    sp::net::message<GameMsg>& msg)
+// I/O 스레드가 수신 큐에 넣은 이벤트를 server_interface::Update 가 바로 넘겨줌 (복사 / 추가 큐 없음)
+void TetrisServer::OnClientValidated(std::shared_ptr<sp::net::connection<GameMsg>> client)
 {
-    uint32_t id = client->GetID();
+    HandleClientValidated(client->GetID());
 
-    // ޽  ̺Ʈ    
-    {
-        std::lock_guard<std::mutex> lock(m_EventMutex);
-        m_EventQueue.push_back({ ServerEventType::MessageReceived, id, msg });
-    }
+    // 클라이언트에게 Accepted 패킷 송신
+    sp::net::message<GameMsg> msg;
+    msg.header.id = GameMsg::Client_Accepted;
+    client->Send(std::move(msg));
 }
 
-void TetrisServer::OnClientValidated(std::shared_ptr<sp::net::connection<GameMsg>> client)
+void TetrisServer::OnClientDisconnect(std::shared_ptr<sp::net::connection<GameMsg>> client)
 {
-    uint32_t id = client->GetID();
+    if (!client)
+        return;
 
-    // ̺Ʈ push
-    {
-        std::lock_guard<std::mutex> lock(m_EventMutex);
-        m_EventQueue.push_back({ ServerEventType::ClientValidated, id });
-    }
+    HandleClientDisconnected(client);
+}
 
-    // Ŭ̾Ʈ Accepted Ŷ ۽ (ASIO )
-    sp::net::message<GameMsg> msg;
-    msg.header.id = GameMsg::Client_Accepted;
-    client->Send(msg);
+void TetrisServer::OnMessage(std::shared_ptr<sp::net::connection<GameMsg>> client,
+    sp::net::message<GameMsg>& msg)
+{
+    HandleMessage(client, msg);
 }
 
 void TetrisServer::OnUpdate()
 {
-    ProcessEvents();    //  忡 ̺Ʈ ó
-    ProcessPingPong();  // Ping/Pong ó
+    ProcessPingPong();      // Ping/Pong 처리
+    ProcessMatchmaking();   // 대기열 배치 매칭
 }
 
-// =====================================================
-// ̺Ʈ ť ó ( )
-// =====================================================
-void TetrisServer::ProcessEvents()
+// 다음 Ping 시각, 다음 매칭 배치, 가장 이른 Pong 타임아웃 중 빠른 쪽 (연결 수와 무관)
+std::chrono::steady_clock::time_point TetrisServer::GetNextWakeTime()
 {
-    std::deque<ServerEvent> events;
-
-    // ASIO ť  ӽ ۷ swap
-    {
-        std::lock_guard<std::mutex> lock(m_EventMutex);
-        events.swap(m_EventQueue);
-    }
-
-    for (auto& ev : events)
-    {
-        switch (ev.type)
-        {
-        case ServerEventType::ClientValidated:
-            HandleClientValidated(ev.clientID);
-            break;
-
-        case ServerEventType::ClientDisconnected:
-            HandleClientDisconnected(ev.clientID);
-            break;
-
-        case ServerEventType::MessageReceived:
-            HandleMessage(ev.clientID, ev.msg);
-            break;
-        }
-    }
+    return std::min({ m_LastPingTime + std::chrono::milliseconds(PING_INTERVAL_MS), m_Matchmaker.GetNextBatchTime(), m_NextTimeoutCheck });
 }
 
 // =====================================================
-// Ŭ̾Ʈ  Ϸ
+// 클라이언트 인증 완료
 // =====================================================
 void TetrisServer::HandleClientValidated(uint32_t id)
 {
+    const auto now = std::chrono::steady_clock::now();
+
     m_ValidatedClients.insert(id);
-    m_LastPongTime[id] = std::chrono::steady_clock::now();
+    m_LastPongTime[id] = now;
+    m_NextTimeoutCheck = std::min(m_NextTimeoutCheck, now + std::chrono::milliseconds(PONG_TIMEOUT_MS));
 
     std::cout << "[Validated] ID = " << id << "\n";
 }
 
 // =====================================================
-//   ó ( )
+// 연결 해제 처리 (메인 스레드)
 // =====================================================
-void TetrisServer::HandleClientDisconnected(uint32_t id)
+void TetrisServer::HandleClientDisconnected(std::shared_ptr<sp::net::connection<GameMsg>> client)
 {
-    m_LastPongTime.erase(id);
+    const uint32_t id = client->GetID();
 
-    bool inGame = (m_mapConnectedPlayers.size() == 2);
-
-    if (inGame)
-    {
-        uint32_t loser = id, winner = 0;
-
-        for (auto& kv : m_mapConnectedPlayers)
-        {
-            if (kv.first != loser)
-            {
-                winner = kv.first;
-                break;
-            }
-        }
-
-        sp::net::message<GameMsg> msgOut;
-        msgOut.header.id = GameMsg::Server_GameOver;
+    m_LastPongTime.erase(id);
 
-        sGameOverInfo info{ winner, loser };
-        msgOut << info;
-
-        MessageAllClients(msgOut);
-    }
+    // 매칭 대기 중이었다면 취소, 게임 중이었다면 방 워커가 상대 승리로 GameOver 전송
+    m_Matchmaker.Cancel(id);
+    m_RoomManager.LeaveRoom(client);
 
     m_ValidatedClients.erase(id);
     m_mapConnectedPlayers.erase(id);
@@ -143,16 +94,11 @@ void TetrisServer::HandleClientDisconnected(uint32_t id)
 }
 
 // =====================================================
-//  ޽ ó ( )
+// 수신 메시지 처리 (메인 스레드)
 // =====================================================
-void TetrisServer::HandleMessage(uint32_t clientID, sp::net::message<GameMsg>& msg)
+void TetrisServer::HandleMessage(std::shared_ptr<sp::net::connection<GameMsg>> client, sp::net::message<GameMsg>& msg)
 {
-    auto client = GetConnectionByID(clientID);
-    if (!client)
-    {
-        std::cout << "[ERROR] Message from invalid clientID=" << clientID << "\n";
-        return;
-    }
+    const uint32_t clientID = client->GetID();
 
     switch (msg.header.id)
     {
@@ -166,16 +112,17 @@ void TetrisServer::HandleMessage(uint32_t clientID, sp::net::message<GameMsg>& m
 
             sp::net::message<GameMsg> out;
             out.header.id = GameMsg::Client_AssignID;
-            out << clientID;
+            out << sNetU32(clientID);
 
-            MessageClient(client, out);
+            MessageClient(client, std::move(out));
             break;
         }
 
         case GameMsg::Client_UnregisterWithServer:
         {
-            uint32_t leavingID{ 0 };
-            msg >> leavingID;
+            // body 가 틀려도 끊는 것은 보낸 연결 기준 (ID 는 로그용)
+            sNetU32 wireID;
+            const uint32_t leavingID = ReadWire(msg, wireID) ? wireID.Get() : clientID;
 
             std::cout << "[Graceful Notice] Client wants to disconnect: " << leavingID << "\n";
 
@@ -192,77 +139,50 @@ void TetrisServer::HandleMessage(uint32_t clientID, sp::net::message<GameMsg>& m
 
         case GameMsg::Client_RequestRoomJoin:
         {
+            if (m_RoomManager.IsInRoom(clientID))
             {
-                sp::net::message<GameMsg> out;
-                out.header.id = GameMsg::Server_RoomJoinAccepted;
-
-                MessageClient(client, out);
+                std::cout << "[Matchmaking] Already in room, ID = " << clientID << "\n";
+                break;
             }
 
-            if (m_mapConnectedPlayers.size() == 2)
-            {
-                {
-                    sp::net::message<GameMsg> out;
-                    out.header.id = GameMsg::Game_SendBagSeed;
-                    out << GenerateSeed();
+            // body 에 레이팅이 있으면 사용, 없거나 크기가 틀리면 등록 정보의 레이팅
+            uint32_t rating = GetPlayerRating(clientID);
 
-                    MessageAllClients(out);
-                }
-
-                {
-                    sp::net::message<GameMsg> out;
-                    out.header.id = GameMsg::Server_AllPlayersReady;
+            sNetU32 wireRating;
+            if (ReadWire(msg, wireRating))
+            {
+                rating = wireRating.Get();
 
-                    MessageAllClients(out);
-                }
+                auto itPlayer = m_mapConnectedPlayers.find(clientID);
+                if (itPlayer != m_mapConnectedPlayers.end())
+                    itPlayer->second.nRating = rating;
             }
 
+            m_Matchmaker.Enqueue(client, rating, std::chrono::steady_clock::now());
             break;
         }
 
         case GameMsg::Game_PlayerDead:
-        {
-            uint32_t loserID;
-            msg >> loserID;
-
-            if (m_mapConnectedPlayers.size() == 2)
-            {
-                uint32_t winnerID = 0;
-                for (auto& kv : m_mapConnectedPlayers)
-                {
-                    if (kv.first != loserID)
-                    {
-                        winnerID = kv.first;
-                        break;
-                    }
-                }
-
-                sp::net::message<GameMsg> out;
-                out.header.id = GameMsg::Server_GameOver;
-
-                sGameOverInfo info{ winnerID, loserID };
-                out << info;
-
-                MessageAllClients(out);
-            }
-            break;
-        }
-
         case GameMsg::Game_CurMinoState:
         case GameMsg::Game_PreviewMinoState:
         case GameMsg::Game_HoldMinoState:
         case GameMsg::Game_BoardState:
+        case GameMsg::Game_BoardDelta:
+        case GameMsg::Game_BoardResyncRequest:
         case GameMsg::Game_UpdatePlayer:
+        case GameMsg::Game_InputBatch:
         {
-            MessageAllClients(msg, client);
+            // 방 워커가 같은 방 상대에게만 전달하거나 (Relay) 서버 엔진에 적용 (Authoritative), body 는 이동
+            if (!m_RoomManager.RouteMessage(client, std::move(msg)))
+                std::cout << "[No Room] GameMsg from ID = " << clientID << "\n";
 
             break;
         }
 
-
         default:
-            std::cout << "[Unvalid GameMsg] " << (uint32_t)msg.header.id << "\n";
-            __debugbreak();
+            // 모르는 패킷을 보낸 연결만 끊음 (서버가 멈추면 모든 방이 끝남)
+            std::cout << "[Unvalid GameMsg] " << (uint32_t)msg.header.id << ", ID = " << clientID << "\n";
+            client->Disconnect();
             break;
     }
 }
@@ -274,22 +194,50 @@ void TetrisServer::ProcessPingPong()
 {
     auto now = std::chrono::steady_clock::now();
 
-    if (std::chrono::duration_cast<std::chrono::milliseconds>(now - m_LastPingTime).count()
-        > PING_INTERVAL_MS)
+    // GetNextWakeTime 의 시각에 깨어났을 때 바로 처리되도록 >=
+    if (now - m_LastPingTime >= std::chrono::milliseconds(PING_INTERVAL_MS))
     {
         PingAllClients();
     }
 
-    CheckTimeouts();
+    // 메시지마다 깨어나므로 기한이 됐을 때만 전체 순회
+    if (now >= m_NextTimeoutCheck)
+        CheckTimeouts();
 }
 
-uint64_t TetrisServer::GenerateSeed()
+// 대기열에서 짝지어진 두 명마다 방 생성 (한 번에 최대 MAX_PAIRS_PER_BATCH 쌍)
+void TetrisServer::ProcessMatchmaking()
 {
-    uint64_t rd = ((uint64_t)std::random_device{}() << 32)
-        ^ (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count()
-        ^ (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+    m_vMatchedPairs.clear();
+
+    if (m_Matchmaker.Update(std::chrono::steady_clock::now(), m_vMatchedPairs) == 0)
+        return;
+
+    size_t nCreated = 0;
+    for (auto& pair : m_vMatchedPairs)
+    {
+        // 배치 사이에 끊긴 쪽은 버리고 남은 쪽만 원래 도착 순서 / 대기 시간 그대로 대기열로 (끊긴 쪽의 Disconnect 처리는 이후 이벤트에서)
+        if (!pair.first.client->IsConnected() || !pair.second.client->IsConnected())
+        {
+            for (auto* ticket : { &pair.first, &pair.second })
+            {
+                if (ticket->client->IsConnected())
+                    m_Matchmaker.Requeue(std::move(*ticket));
+            }
+            continue;
+        }
+
+        m_RoomManager.CreateRoom(std::move(pair.first.client), std::move(pair.second.client));
+        ++nCreated;
+    }
 
-    return rd;
+    std::cout << "[Matchmaking] Rooms Created " << nCreated << ", Waiting " << m_Matchmaker.GetQueuedCount() << "\n";
+}
+
+uint32_t TetrisServer::GetPlayerRating(uint32_t clientID) const
+{
+    auto it = m_mapConnectedPlayers.find(clientID);
+    return it != m_mapConnectedPlayers.end() ? it->second.nRating : NET_DEFAULT_RATING;
 }
 
 void TetrisServer::PingAllClients()
@@ -297,7 +245,9 @@ void TetrisServer::PingAllClients()
     sp::net::message<GameMsg> msgOut;
     msgOut.header.id = GameMsg::Server_Ping;
 
-    for (auto& client : m_deqConnections)
+    auto pPing = std::make_shared<const sp::net::message<GameMsg>>(std::move(msgOut));
+
+    for (auto& client : m_vConnections)
     {
         if (!client || !client->IsConnected())
             continue;
@@ -305,7 +255,7 @@ void TetrisServer::PingAllClients()
         uint32_t id = client->GetID();
 
         if (IsClientValidated(id))
-            client->Send(msgOut);
+            client->Send(pPing);
     }
 
     m_LastPingTime = std::chrono::steady_clock::now();
@@ -314,6 +264,7 @@ void TetrisServer::PingAllClients()
 void TetrisServer::CheckTimeouts()
 {
     auto now = std::chrono::steady_clock::now();
+    m_NextTimeoutCheck = std::chrono::steady_clock::time_point::max();
 
     for (auto it = m_LastPongTime.begin(); it != m_LastPongTime.end();)
     {
@@ -325,9 +276,7 @@ void TetrisServer::CheckTimeouts()
             continue;
         }
 
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second).count();
-
-        if (elapsed > PONG_TIMEOUT_MS)
+        if (now - it->second >= std::chrono::milliseconds(PONG_TIMEOUT_MS))
         {
             std::cout << "[Timeout] " << id << "\n";
 
@@ -339,6 +288,7 @@ void TetrisServer::CheckTimeouts()
         }
         else
         {
+            m_NextTimeoutCheck = std::min(m_NextTimeoutCheck, it->second + std::chrono::milliseconds(PONG_TIMEOUT_MS));
             ++it;
         }
     }
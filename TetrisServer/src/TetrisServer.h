@@ -1,74 +1,62 @@
 #pragma once
 
 #include "common/PacketProtocol.h"
+#include "room/Matchmaker.h"
+#include "room/RoomManager.h"
 
 // -----------------------------
-// ̺Ʈ Ÿ
-// -----------------------------
-enum class ServerEventType
-{
-    ClientValidated,
-    ClientDisconnected,
-    MessageReceived
-};
-
-// -----------------------------
-// ν忡 ó ̺Ʈ 
-// -----------------------------
-struct ServerEvent
-{
-    ServerEventType type{};
-    uint32_t clientID{};                       // Ŭ̾Ʈ ĺ
-    sp::net::message<GameMsg> msg{};           // ޽ (MessageReceived  )
-};
-
-// -----------------------------
-//  ü
+// 서버 본체
+//  - 메인 스레드: 접속 / 인증 / Ping / 매칭 / 방 배정
+//  - 게임 패킷: 해당 방을 맡은 RoomWorker 스레드로 넘김
 // -----------------------------
 class TetrisServer : public sp::net::server_interface<GameMsg>
 {
 public:
-    TetrisServer(uint16_t nPort);
+    TetrisServer(uint16_t nPort, size_t nIoThreads = 1, size_t nRoomWorkers = 1, NetSyncMode syncMode = NetSyncMode::Relay);
+    ~TetrisServer();
 
 protected:
-    // ASIO  ݹ
+    // ASIO 스레드 콜백
     bool OnClientConnect(std::shared_ptr<sp::net::connection<GameMsg>> client) override;
+
+    // 메인스레드 콜백 (server_interface::Update 가 수신 큐에서 꺼낸 순서대로 호출)
+    void OnClientValidated(std::shared_ptr<sp::net::connection<GameMsg>> client) override;
     void OnClientDisconnect(std::shared_ptr<sp::net::connection<GameMsg>> client) override;
     void OnMessage(std::shared_ptr<sp::net::connection<GameMsg>> client,
         sp::net::message<GameMsg>& msg) override;
-    void OnClientValidated(std::shared_ptr<sp::net::connection<GameMsg>> client) override;
 
-    // ν ֱ 
+    // 메인스레드 주기적 실행
     void OnUpdate() override;
+    std::chrono::steady_clock::time_point GetNextWakeTime() override;
 
 private:
-    //   ó Լ
-    void ProcessEvents();
+    // 메인 스레드 처리 함수
     void ProcessPingPong();
+    void ProcessMatchmaking();
+    uint32_t GetPlayerRating(uint32_t clientID) const;
 
     void HandleClientValidated(uint32_t id);
-    void HandleClientDisconnected(uint32_t id);
-    void HandleMessage(uint32_t clientID, sp::net::message<GameMsg>& msg);
+    void HandleClientDisconnected(std::shared_ptr<sp::net::connection<GameMsg>> client);
+    void HandleMessage(std::shared_ptr<sp::net::connection<GameMsg>> client, sp::net::message<GameMsg>& msg);
 
     bool IsClientValidated(uint32_t id) const;
 
 private:
-    //   
-    uint64_t GenerateSeed();
     void PingAllClients();
     void CheckTimeouts();
 
 private:
-    //  Ŭ̾Ʈ 
+    // 인증된 클라이언트 목록
     std::unordered_set<uint32_t> m_ValidatedClients;
 
-    //  ÷̾
+    // 등록된 플레이어
     std::unordered_map<uint32_t, sPlayerDescription> m_mapConnectedPlayers;
     std::vector<uint32_t> m_vGarbageIDs;
 
-    // ASIO  Main Thread ̺Ʈ ť
-    std::mutex m_EventMutex;
-    std::deque<ServerEvent> m_EventQueue;
+    // 매칭 대기열 → 방 배정 / 방 워커 스레드
+    Matchmaker m_Matchmaker;
+    std::vector<Matchmaker::sMatchPair> m_vMatchedPairs;    // ProcessMatchmaking 에서 재사용
+    RoomManager m_RoomManager;
 
     // Ping/Pong
     std::unordered_map<uint32_t, std::chrono::steady_clock::time_point> m_LastPongTime;
@@ -77,4 +65,8 @@ private:
     static constexpr int PONG_TIMEOUT_MS = 5000;
 
     std::chrono::steady_clock::time_point m_LastPingTime{};
+
+    // 가장 이른 Pong 기한 (이 시각 전에는 타임아웃 검사를 하지 않음)
+    // Pong 은 기한을 늦추기만 하므로 검사 때 다시 계산하면 충분
+    std::chrono::steady_clock::time_point m_NextTimeoutCheck = std::chrono::steady_clock::time_point::max();
 };
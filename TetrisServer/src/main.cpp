@@ -1,13 +1,24 @@
 #include "TetrisServer.h"
 
-int main()
+int main(int argc, char* argv[])
 {
-	TetrisServer server(60000);
+	// --authoritative : 클라이언트는 입력만 보내고 서버가 플레이어별 엔진으로 상태를 계산
+	NetSyncMode syncMode = NetSyncMode::Relay;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::string(argv[i]) == "--authoritative")
+			syncMode = NetSyncMode::Authoritative;
+	}
+
+	// 소켓 I/O 와 방 워커는 각각 코어 수만큼의 스레드에서, 접속 / 방 배정은 이 메인 스레드에서 처리
+	// 메인 스레드는 메시지나 다음 Ping / Pong 타이머까지 잠듦 (접속자가 없으면 CPU 를 쓰지 않음)
+	const size_t nThreads = std::max(1u, std::thread::hardware_concurrency());
+	TetrisServer server(60000, nThreads, nThreads, syncMode);
 	server.Start();
 
 	while (true)
 	{
-		server.Update(-1, false);
+		server.Update(-1, true);
 	}
 
 	return 0;
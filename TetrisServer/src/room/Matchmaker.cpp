@@ -0,0 +1,177 @@
+#include "Matchmaker.h"
+#include <algorithm>
+
+bool Matchmaker::Enqueue(ClientPtr client, uint32_t rating, std::chrono::steady_clock::time_point now)
+{
+    const uint32_t clientID = client->GetID();
+    if (IsQueued(clientID))
+        return false;
+
+    TicketList& list = m_mapQueues[rating];
+    const uint64_t nSeq = ++m_nSeqCounter;
+    list.push_back({ std::move(client), rating, nSeq, now });
+
+    m_mapTickets[clientID] = { rating, std::prev(list.end()) };
+    m_deqArrivals.push_back({ clientID, nSeq });
+    return true;
+}
+
+bool Matchmaker::Requeue(sMatchTicket ticket)
+{
+    const uint32_t clientID = ticket.client->GetID();
+    if (IsQueued(clientID))
+        return false;
+
+    const uint32_t rating = ticket.rating;
+    const uint64_t nSeq = ticket.nSeq;
+
+    // 같은 레이팅 안 도착 순서 유지 (상대가 끊긴 경우에만 불리므로 선형 탐색)
+    TicketList& list = m_mapQueues[rating];
+    auto itPos = std::find_if(list.begin(), list.end(), [nSeq](const sMatchTicket& t) { return t.nSeq > nSeq; });
+    m_mapTickets[clientID] = { rating, list.insert(itPos, std::move(ticket)) };
+
+    // 상대로 뽑혀 매칭된 경우 이전 도착 항목이 아직 남아 있으면 그대로 다시 유효해짐
+    auto itArrival = std::lower_bound(m_deqArrivals.begin(), m_deqArrivals.end(), nSeq,
+        [](const sArrival& arrival, uint64_t seq) { return arrival.nSeq < seq; });
+
+    if (itArrival == m_deqArrivals.end() || itArrival->nSeq != nSeq)
+        m_deqArrivals.insert(itArrival, { clientID, nSeq });
+
+    return true;
+}
+
+void Matchmaker::Cancel(uint32_t clientID)
+{
+    auto it = m_mapTickets.find(clientID);
+    if (it == m_mapTickets.end())
+        return;
+
+    Remove(it->second);
+    m_mapTickets.erase(it);
+
+    if (m_mapTickets.empty())
+        m_deqArrivals.clear();
+}
+
+size_t Matchmaker::Update(std::chrono::steady_clock::time_point now, std::vector<sMatchPair>& vPairs)
+{
+    if (m_mapTickets.size() < 2 || now - m_LastBatchTime < std::chrono::milliseconds(BATCH_INTERVAL_MS))
+        return 0;
+
+    m_LastBatchTime = now;
+
+    // 오래 기다린 사람부터 (범위가 가장 넓으므로 먼저 상대를 고름)
+    size_t nPairs = 0;
+    m_vRemaining.clear();
+
+    while (!m_deqArrivals.empty())
+    {
+        const sArrival arrival = m_deqArrivals.front();
+        m_deqArrivals.pop_front();
+
+        auto it = m_mapTickets.find(arrival.clientID);
+        if (it == m_mapTickets.end() || it->second.it->nSeq != arrival.nSeq)
+            continue;   // 취소 또는 이번 배치에서 이미 매칭됨
+
+        if (nPairs >= MAX_PAIRS_PER_BATCH)
+        {
+            m_vRemaining.push_back(arrival);
+            continue;
+        }
+
+        const sMatchTicket& ticket = *it->second.it;
+
+        sTicketRef opponentRef;
+        if (!FindOpponent(ticket, GetWindow(ticket, now), opponentRef))
+        {
+            m_vRemaining.push_back(arrival);
+            continue;
+        }
+
+        const uint32_t opponentID = opponentRef.it->client->GetID();
+        vPairs.push_back({ ticket, *opponentRef.it });
+        ++nPairs;
+
+        Remove(opponentRef);
+        m_mapTickets.erase(opponentID);
+
+        Remove(it->second);
+        m_mapTickets.erase(it);
+    }
+
+    m_deqArrivals.assign(m_vRemaining.begin(), m_vRemaining.end());
+    return nPairs;
+}
+
+std::chrono::steady_clock::time_point Matchmaker::GetNextBatchTime() const
+{
+    if (m_mapTickets.size() < 2)
+        return std::chrono::steady_clock::time_point::max();
+
+    return m_LastBatchTime + std::chrono::milliseconds(BATCH_INTERVAL_MS);
+}
+
+uint32_t Matchmaker::GetWindow(const sMatchTicket& ticket, std::chrono::steady_clock::time_point now)
+{
+    const auto waitedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - ticket.tpEnqueued).count();
+    const uint64_t window = BASE_WINDOW + (uint64_t)waitedMs * WINDOW_GROWTH_PER_SEC / 1000;
+
+    return (uint32_t)std::min<uint64_t>(window, MAX_WINDOW);
+}
+
+bool Matchmaker::FindOpponent(const sMatchTicket& ticket, uint32_t window, sTicketRef& outRef)
+{
+    auto itUp = m_mapQueues.lower_bound(ticket.rating);
+
+    // 같은 레이팅: 자신을 뺀 가장 오래 기다린 사람
+    if (itUp != m_mapQueues.end() && itUp->first == ticket.rating)
+    {
+        for (auto candidate = itUp->second.begin(); candidate != itUp->second.end(); ++candidate)
+        {
+            if (candidate->client != ticket.client)
+            {
+                outRef = { itUp->first, candidate };
+                return true;
+            }
+        }
+
+        ++itUp;
+    }
+
+    // 바로 아래 / 위 레이팅의 맨 앞 (리스트 안은 차이가 같으므로 맨 앞이 범위 밖이면 전부 범위 밖)
+    auto itDown = m_mapQueues.lower_bound(ticket.rating);
+    const bool bDown = itDown != m_mapQueues.begin() && ticket.rating - std::prev(itDown)->first <= window;
+    const bool bUp = itUp != m_mapQueues.end() && itUp->first - ticket.rating <= window;
+
+    if (!bDown && !bUp)
+        return false;
+
+    if (bDown)
+        --itDown;
+
+    // 차이가 같으면 오래 기다린 쪽
+    bool bPickUp = bUp;
+    if (bDown && bUp)
+    {
+        const uint32_t downDiff = ticket.rating - itDown->first;
+        const uint32_t upDiff = itUp->first - ticket.rating;
+        bPickUp = upDiff < downDiff || (upDiff == downDiff && itUp->second.front().nSeq < itDown->second.front().nSeq);
+    }
+
+    auto itPick = bPickUp ? itUp : itDown;
+    outRef = { itPick->first, itPick->second.begin() };
+    return true;
+}
+
+void Matchmaker::Remove(const sTicketRef& ref)
+{
+    auto it = m_mapQueues.find(ref.rating);
+    if (it == m_mapQueues.end())
+        return;
+
+    it->second.erase(ref.it);
+
+    // 빈 리스트는 지워서 위 / 아래 탐색에 걸리지 않게 함
+    if (it->second.empty())
+        m_mapQueues.erase(it);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../common/PacketProtocol.h"
+#include <list>
+#include <map>
+
+// -----------------------------
+// 레이팅 매칭 대기열 (메인 스레드 전용)
+//  - 대기자는 레이팅 값별 도착 순서 리스트에 보관 (같은 리스트 안은 레이팅 차이가 모두 같음)
+//  - Update 에서 오래 기다린 사람부터 한 번에 짝을 지음
+//    허용 레이팅 차이는 기다린 시간에 비례해 넓어짐
+//  - 등록 / 취소 / 상대 찾기 모두 map 조회 O(log n)
+//    (상대는 같은 레이팅, 바로 위 / 아래 레이팅 리스트의 맨 앞만 보면 됨)
+// -----------------------------
+class Matchmaker
+{
+public:
+    static constexpr uint32_t BASE_WINDOW = 100;            // 바로 매칭되는 레이팅 차이
+    static constexpr uint32_t WINDOW_GROWTH_PER_SEC = 50;   // 1초 기다릴 때마다 넓어지는 폭
+    static constexpr uint32_t MAX_WINDOW = 1000;
+    static constexpr int BATCH_INTERVAL_MS = 250;
+    static constexpr size_t MAX_PAIRS_PER_BATCH = 1024;     // 한 번에 너무 오래 메인 스레드를 잡지 않도록
+
+    using ClientPtr = std::shared_ptr<sp::net::connection<GameMsg>>;
+
+    struct sMatchTicket
+    {
+        ClientPtr client;
+        uint32_t rating = 0;
+        uint64_t nSeq = 0;      // 도착 순서. 취소 후 다시 등록한 경우 m_deqArrivals 의 이전 항목과 구분
+        std::chrono::steady_clock::time_point tpEnqueued{};
+    };
+
+    // 방을 만들기 전에 한쪽이 끊기면 남은 쪽 ticket 을 그대로 Requeue
+    struct sMatchPair
+    {
+        sMatchTicket first;
+        sMatchTicket second;
+    };
+
+public:
+    // 이미 대기 중이면 false
+    bool Enqueue(ClientPtr client, uint32_t rating, std::chrono::steady_clock::time_point now);
+
+    // 매칭됐던 ticket 을 원래 도착 순서 / 대기 시간 그대로 되돌림 (이미 대기 중이면 false)
+    bool Requeue(sMatchTicket ticket);
+    void Cancel(uint32_t clientID);
+
+    const bool IsQueued(uint32_t clientID) const { return m_mapTickets.count(clientID) > 0; }
+    const size_t GetQueuedCount() const { return m_mapTickets.size(); }
+
+    // BATCH_INTERVAL_MS 마다 짝을 지어 vPairs 에 추가하고 개수 반환
+    size_t Update(std::chrono::steady_clock::time_point now, std::vector<sMatchPair>& vPairs);
+
+    // 대기자가 없으면 time_point::max()
+    std::chrono::steady_clock::time_point GetNextBatchTime() const;
+
+private:
+    struct sArrival
+    {
+        uint32_t clientID = 0;
+        uint64_t nSeq = 0;
+    };
+
+    using TicketList = std::list<sMatchTicket>;
+
+    struct sTicketRef
+    {
+        uint32_t rating = 0;
+        TicketList::iterator it;
+    };
+
+    static uint32_t GetWindow(const sMatchTicket& ticket, std::chrono::steady_clock::time_point now);
+
+    // ticket 을 제외하고 허용 범위 안에서 레이팅이 가장 가까운 대기자 (차이가 같으면 오래 기다린 쪽)
+    bool FindOpponent(const sMatchTicket& ticket, uint32_t window, sTicketRef& outRef);
+    void Remove(const sTicketRef& ref);
+
+private:
+    std::map<uint32_t, TicketList> m_mapQueues;             // 레이팅 → 도착 순서 (빈 리스트는 두지 않음)
+    std::unordered_map<uint32_t, sTicketRef> m_mapTickets;  // clientID → 위치
+
+    std::deque<sArrival> m_deqArrivals;                     // 전체 도착 순서, nSeq 오름차순 (취소 / 매칭된 항목은 Update 에서 걸러냄)
+    std::vector<sArrival> m_vRemaining;                     // Update 에서 재사용
+    uint64_t m_nSeqCounter = 0;
+
+    std::chrono::steady_clock::time_point m_LastBatchTime{};
+};
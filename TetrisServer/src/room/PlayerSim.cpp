@@ -0,0 +1,123 @@
+#include "PlayerSim.h"
+#include <algorithm>
+
+using namespace Tetris;
+
+PlayerSim::PlayerSim(uint64_t nSeed)
+    : m_Engine(nSeed)
+{
+    m_Engine.ClearEvents();
+}
+
+// =====================================================
+// 입력 / 진행
+// =====================================================
+uint64_t PlayerSim::ApplyInput(uint64_t tick, uint8_t inputs, uint64_t serverTick)
+{
+    const uint64_t applied = ClampTick(tick, serverTick);
+    UpdateLag(applied, serverTick);
+
+    AdvanceTo(applied);
+
+    if (!m_Engine.IsGameOver())
+    {
+        m_Engine.Step(inputs & VALID_INPUTS, 0);
+        m_Engine.ClearEvents();
+
+        m_vUnsentInputs.push_back({ applied, static_cast<uint8_t>(inputs & VALID_INPUTS) });
+    }
+
+    return applied;
+}
+
+void PlayerSim::Confirm(uint64_t tick, uint64_t serverTick)
+{
+    const uint64_t confirmed = ClampTick(tick, serverTick);
+    UpdateLag(confirmed, serverTick);
+
+    AdvanceTo(confirmed);
+    m_ReportedTick = std::max(m_ReportedTick, confirmed);
+}
+
+void PlayerSim::ForceAdvance(uint64_t serverTick)
+{
+    const int64_t forced = static_cast<int64_t>(serverTick) - m_nMinLag - static_cast<int64_t>(MAX_INPUT_DELAY_TICKS);
+    if (forced > 0)
+        AdvanceTo(static_cast<uint64_t>(forced));
+}
+
+// 이미 진행한 tick 이전으로는 되돌릴 수 없고, 서버 시간보다 너무 앞선 tick 은 허용하지 않음
+// (거대한 tick 으로 중력 루프를 오래 돌리게 하는 것도 막음)
+uint64_t PlayerSim::ClampTick(uint64_t tick, uint64_t serverTick) const
+{
+    return std::clamp(tick, m_Engine.GetTick(), std::max(m_Engine.GetTick(), serverTick + MAX_INPUT_DELAY_TICKS));
+}
+
+void PlayerSim::UpdateLag(uint64_t tick, uint64_t serverTick)
+{
+    const int64_t lag = static_cast<int64_t>(serverTick) - static_cast<int64_t>(tick);
+
+    if (!m_bHasLag || lag < m_nMinLag)
+    {
+        m_nMinLag = lag;
+        m_bHasLag = true;
+    }
+}
+
+void PlayerSim::AdvanceTo(uint64_t tick)
+{
+    while (!m_Engine.IsGameOver() && m_Engine.GetTick() < tick)
+    {
+        const uint64_t ticks = std::min<uint64_t>(tick - m_Engine.GetTick(), UINT32_MAX);
+        m_Engine.Step(INPUT_NONE, static_cast<uint32_t>(ticks));
+    }
+
+    // 판정은 엔진 상태로만 하므로 이벤트는 버림
+    m_Engine.ClearEvents();
+}
+
+// =====================================================
+// 상대에게 중계 / 본인에게 확정
+// =====================================================
+bool PlayerSim::BuildSyncMessages(std::vector<sp::net::message<GameMsg>>& vToOpponent, sp::net::message<GameMsg>& toOwner)
+{
+    const uint64_t tick = m_Engine.GetTick();
+    if (m_vUnsentInputs.empty() && tick == m_SentTick && m_ReportedTick == m_AckedTick)
+        return false;
+
+    size_t nSent = 0;
+    do
+    {
+        // 한 배치에 다 못 담으면 다음 배치 첫 입력의 tick 까지만 확정으로 보냄
+        const size_t nEnd = std::min<size_t>(m_vUnsentInputs.size(), nSent + NET_MAX_INPUTS_PER_BATCH);
+        const uint64_t batchTick = (nEnd < m_vUnsentInputs.size()) ? m_vUnsentInputs[nEnd].tick : tick;
+
+        sp::net::message<GameMsg> out;
+        out.header.id = GameMsg::Game_InputBatch;
+
+        sInputBatchHeader header;
+        header.tick.Set(static_cast<uint32_t>(batchTick));
+
+        for (; nSent < nEnd; ++nSent)
+        {
+            sInputEventWire ev;
+            ev.tickBack.Set(static_cast<uint16_t>(std::min<uint64_t>(batchTick - m_vUnsentInputs[nSent].tick, UINT16_MAX)));
+            ev.inputs = m_vUnsentInputs[nSent].inputs;
+
+            out << ev;
+            ++header.count;
+        }
+
+        out << header;
+        vToOpponent.push_back(std::move(out));
+    } while (nSent < m_vUnsentInputs.size());
+
+    m_vUnsentInputs.clear();
+    m_SentTick = tick;
+
+    toOwner.header.id = GameMsg::Game_InputAck;
+    toOwner << sNetU32(static_cast<uint32_t>(m_ReportedTick));
+    m_AckedTick = m_ReportedTick;
+
+    return true;
+}
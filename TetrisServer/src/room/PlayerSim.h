@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../common/PacketProtocol.h"
+#include "engine/GameEngine.h"
+#include <vector>
+
+// -----------------------------
+// 권한 모드에서 플레이어 한 명의 서버 측 시뮬레이션
+//  - 클라이언트와 같은 시드의 GameEngine 에 클라이언트가 보낸 입력을 같은 tick 에 적용
+//    → 정상 클라이언트라면 로컬 예측과 항상 같은 결과 (엔진은 Step 분할과 무관)
+//  - tick 검증
+//      과거 (이미 진행한 tick) : 현재 tick 에 적용하고 보정 알림
+//      미래 (서버 시간 + 허용치 초과) : 허용치까지 잘라서 적용
+//      입력이 끊김 : 서버 시간 - 지연 - 허용치 까지 강제 진행 (멈춰서 중력을 피할 수 없음)
+//  - 실제로 적용한 입력과 진행 tick 을 상대에게 중계 → 상대 클라이언트가 같은 엔진으로 재현 (롤백 예측)
+// -----------------------------
+class PlayerSim
+{
+public:
+    // 클라이언트가 보고한 tick 과 서버 tick 의 차이 (최소 지연) 에 더해 허용하는 지연
+    static constexpr uint64_t MAX_INPUT_DELAY_TICKS = 500;
+
+    static constexpr uint8_t VALID_INPUTS = 0x7F;   // Tetris::InputFlag 전체
+
+public:
+    explicit PlayerSim(uint64_t nSeed);
+
+    // tick 에 입력 적용 후 실제로 적용한 tick 반환 (다르면 클라이언트에 보정 전송)
+    uint64_t ApplyInput(uint64_t tick, uint8_t inputs, uint64_t serverTick);
+
+    // 클라이언트가 tick 까지 입력 없이 진행했음 → 그 tick 까지 중력 진행
+    void Confirm(uint64_t tick, uint64_t serverTick);
+
+    // 보고가 끊긴 클라이언트를 서버 시간 기준으로 진행
+    void ForceAdvance(uint64_t serverTick);
+
+    // 마지막 호출 이후 적용한 입력과 진행 tick. 바뀐 게 없으면 false
+    //  vToOpponent: Game_InputBatch (적용한 tick 기준, 서버 엔진 tick 까지 확정)
+    //  toOwner    : Game_InputAck (클라이언트가 보고한 tick 까지 확정 → 그 이전 스냅샷 정리)
+    bool BuildSyncMessages(std::vector<sp::net::message<GameMsg>>& vToOpponent, sp::net::message<GameMsg>& toOwner);
+
+    const bool IsGameOver() const { return m_Engine.IsGameOver(); }
+    const uint64_t GetTick() const { return m_Engine.GetTick(); }
+
+private:
+    uint64_t ClampTick(uint64_t tick, uint64_t serverTick) const;
+    void UpdateLag(uint64_t tick, uint64_t serverTick);
+
+    void AdvanceTo(uint64_t tick);
+
+private:
+    GameEngine m_Engine;
+
+    // 가장 작은 (서버 tick - 클라이언트 tick). 클라이언트는 서버보다 늦게 시작하므로 보통 양수
+    int64_t m_nMinLag = 0;
+    bool m_bHasLag = false;
+
+    // 클라이언트가 보고한 진행 tick (이 tick 까지의 입력은 모두 받았고, 보정도 이미 보냄)
+    uint64_t m_ReportedTick = 0;
+
+    // --- 마지막 BuildSyncMessages 이후 ---
+    std::vector<sInputEvent> m_vUnsentInputs;
+    uint64_t m_SentTick = 0;
+    uint64_t m_AckedTick = 0;
+};
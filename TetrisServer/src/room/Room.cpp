@@ -0,0 +1,313 @@
+#include "Room.h"
+#include <iostream>
+
+Room::Room(uint32_t nRoomID, uint64_t nSeed, NetSyncMode syncMode)
+    : m_nRoomID(nRoomID)
+    , m_nSeed(nSeed)
+    , m_SyncMode(syncMode)
+{
+}
+
+// =====================================================
+// 입장 / 퇴장
+// =====================================================
+void Room::AddPlayer(std::shared_ptr<sp::net::connection<GameMsg>> client)
+{
+    for (auto& slot : m_Players)
+    {
+        if (slot)
+            continue;
+
+        slot = std::move(client);
+
+        sp::net::message<GameMsg> out;
+        out.header.id = GameMsg::Server_RoomJoinAccepted;
+        slot->Send(std::move(out));
+
+        std::cout << "[Room " << m_nRoomID << "] Join ID = " << slot->GetID() << "\n";
+
+        if (m_State == RoomState::Waiting && GetPlayerCount() == ROOM_CAPACITY)
+            StartGame();
+
+        return;
+    }
+
+    std::cout << "[Room " << m_nRoomID << "] Full, join ignored ID = " << client->GetID() << "\n";
+}
+
+void Room::RemovePlayer(uint32_t clientID)
+{
+    for (auto& slot : m_Players)
+    {
+        if (!slot || slot->GetID() != clientID)
+            continue;
+
+        // 게임 중 이탈 → 남은 플레이어 승리
+        if (m_State == RoomState::Playing)
+        {
+            auto opponent = GetOpponent(clientID);
+            FinishGame(opponent ? opponent->GetID() : 0, clientID);
+        }
+
+        slot.reset();
+
+        std::cout << "[Room " << m_nRoomID << "] Leave ID = " << clientID << "\n";
+        return;
+    }
+}
+
+const size_t Room::GetPlayerCount() const
+{
+    size_t nCount = 0;
+    for (auto& slot : m_Players)
+    {
+        if (slot)
+            ++nCount;
+    }
+    return nCount;
+}
+
+// =====================================================
+// 게임 패킷 처리
+// =====================================================
+void Room::HandleMessage(const std::shared_ptr<sp::net::connection<GameMsg>>& client, sp::net::message<GameMsg>& msg)
+{
+    if (m_State != RoomState::Playing)
+        return;
+
+    if (m_SyncMode == NetSyncMode::Authoritative)
+    {
+        const size_t nSlot = GetSlot(client->GetID());
+        if (nSlot < ROOM_CAPACITY)
+            HandleAuthoritativeMessage(nSlot, msg);
+        return;
+    }
+
+    switch (msg.header.id)
+    {
+        case GameMsg::Game_PlayerDead:
+        {
+            // 패자는 보낸 연결 기준 (다른 방 / 다른 플레이어 ID 로 위조 불가)
+            auto opponent = GetOpponent(client->GetID());
+            FinishGame(opponent ? opponent->GetID() : 0, client->GetID());
+            break;
+        }
+
+        case GameMsg::Game_CurMinoState:
+        case GameMsg::Game_PreviewMinoState:
+        case GameMsg::Game_HoldMinoState:
+        case GameMsg::Game_BoardState:
+        case GameMsg::Game_BoardDelta:
+        case GameMsg::Game_BoardResyncRequest:
+        case GameMsg::Game_UpdatePlayer:
+        {
+            // 크기가 틀린 body 는 상대 클라이언트가 읽다가 넘칠 수 있으므로 버림
+            if (!IsRelayBodyValid(msg))
+            {
+                std::cout << "[Room " << m_nRoomID << "] Malformed GameMsg " << (uint32_t)msg.header.id << "\n";
+                break;
+            }
+
+            // 1:1 이므로 상대 한 명에게 body 를 그대로 넘김 (복사 없음)
+            auto opponent = GetOpponent(client->GetID());
+            if (opponent && opponent->IsConnected())
+                opponent->Send(std::move(msg));
+            break;
+        }
+
+        default:
+            std::cout << "[Room " << m_nRoomID << "] Unvalid GameMsg " << (uint32_t)msg.header.id << "\n";
+            break;
+    }
+}
+
+// =====================================================
+// 권한 모드
+// =====================================================
+void Room::HandleAuthoritativeMessage(size_t nSlot, sp::net::message<GameMsg>& msg)
+{
+    switch (msg.header.id)
+    {
+        case GameMsg::Game_InputBatch:
+        {
+            ApplyInputBatch(nSlot, msg);
+            FlushSims();
+            break;
+        }
+
+        default:
+            // 상태 / 사망 / 재동기화 패킷은 서버가 직접 계산하므로 받지 않음
+            break;
+    }
+}
+
+void Room::ApplyInputBatch(size_t nSlot, sp::net::message<GameMsg>& msg)
+{
+    sInputBatchHeader header;
+    std::array<sInputEvent, NET_MAX_INPUTS_PER_BATCH> events;
+
+    if (!ReadInputBatch(msg, header, events))
+    {
+        std::cout << "[Room " << m_nRoomID << "] Malformed InputBatch\n";
+        return;
+    }
+
+    PlayerSim& sim = *m_Sims[nSlot];
+    const uint64_t serverTick = GetServerTick(std::chrono::steady_clock::now());
+
+    for (int i = 0; i < header.count; ++i)
+    {
+        const uint64_t tick = events[i].tick;
+        const uint64_t applied = sim.ApplyInput(tick, events[i].inputs, serverTick);
+
+        // 늦게 도착한 입력 → 클라이언트가 같은 tick 으로 다시 시뮬레이션하도록 알림
+        if (applied != tick)
+        {
+            sp::net::message<GameMsg> out;
+            out.header.id = GameMsg::Game_InputCorrection;
+            out << sInputCorrection{ sNetU32(static_cast<uint32_t>(tick)), sNetU32(static_cast<uint32_t>(applied)) };
+
+            m_Players[nSlot]->Send(std::move(out));
+        }
+    }
+
+    sim.Confirm(header.tick.Get(), serverTick);
+}
+
+void Room::Tick(std::chrono::steady_clock::time_point now)
+{
+    if (m_SyncMode != NetSyncMode::Authoritative || m_State != RoomState::Playing)
+        return;
+
+    const uint64_t serverTick = GetServerTick(now);
+    for (auto& sim : m_Sims)
+    {
+        if (sim)
+            sim->ForceAdvance(serverTick);
+    }
+
+    FlushSims();
+}
+
+// 각 플레이어가 적용한 입력을 상대에게 중계 + 본인에게 확정 tick, 서버 엔진 기준으로 게임 오버 판정
+void Room::FlushSims()
+{
+    for (size_t i = 0; i < ROOM_CAPACITY; ++i)
+    {
+        if (!m_Sims[i])
+            continue;
+
+        auto& owner = m_Players[i];
+        auto& opponent = m_Players[(i + 1) % ROOM_CAPACITY];
+
+        m_vSyncMessages.clear();
+        sp::net::message<GameMsg> ack;
+        if (!m_Sims[i]->BuildSyncMessages(m_vSyncMessages, ack))
+            continue;
+
+        if (owner && owner->IsConnected())
+            owner->Send(std::move(ack));
+
+        if (opponent && opponent->IsConnected())
+        {
+            for (auto& out : m_vSyncMessages)
+                opponent->Send(std::move(out));
+        }
+    }
+
+    for (size_t i = 0; i < ROOM_CAPACITY && m_State == RoomState::Playing; ++i)
+    {
+        if (!m_Sims[i] || !m_Sims[i]->IsGameOver() || !m_Players[i])
+            continue;
+
+        auto& opponent = m_Players[(i + 1) % ROOM_CAPACITY];
+        FinishGame(opponent ? opponent->GetID() : 0, m_Players[i]->GetID());
+    }
+}
+
+uint64_t Room::GetServerTick(std::chrono::steady_clock::time_point now) const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - m_StartTime).count());
+}
+
+// =====================================================
+// 게임 시작 / 종료
+// =====================================================
+void Room::StartGame()
+{
+    m_State = RoomState::Playing;
+
+    // 클라이언트와 같은 시드로 플레이어별 엔진 준비 (서버 tick 0 = 지금)
+    if (m_SyncMode == NetSyncMode::Authoritative)
+    {
+        for (size_t i = 0; i < ROOM_CAPACITY; ++i)
+            m_Sims[i] = std::make_unique<PlayerSim>(m_nSeed);
+
+        m_StartTime = std::chrono::steady_clock::now();
+    }
+
+    {
+        sp::net::message<GameMsg> out;
+        out.header.id = GameMsg::Game_SendBagSeed;
+        out << sNetU64(m_nSeed);
+
+        SendToAll(std::move(out));
+    }
+
+    {
+        sp::net::message<GameMsg> out;
+        out.header.id = GameMsg::Server_AllPlayersReady;
+        out << m_SyncMode;
+
+        SendToAll(std::move(out));
+    }
+
+    std::cout << "[Room " << m_nRoomID << "] Game Start" << (m_SyncMode == NetSyncMode::Authoritative ? " (authoritative)" : "") << "\n";
+}
+
+void Room::FinishGame(uint32_t winnerID, uint32_t loserID)
+{
+    m_State = RoomState::Finished;
+
+    sp::net::message<GameMsg> out;
+    out.header.id = GameMsg::Server_GameOver;
+
+    sGameOverInfo info{ winnerID, loserID };
+    out << info;
+
+    SendToAll(std::move(out));
+
+    std::cout << "[Room " << m_nRoomID << "] Game Over, winner = " << winnerID << "\n";
+}
+
+// 두 명에게 같은 body 를 공유 버퍼로 전송
+void Room::SendToAll(sp::net::message<GameMsg>&& msg)
+{
+    auto pMsg = std::make_shared<const sp::net::message<GameMsg>>(std::move(msg));
+
+    for (auto& slot : m_Players)
+    {
+        if (slot && slot->IsConnected())
+            slot->Send(pMsg);
+    }
+}
+
+std::shared_ptr<sp::net::connection<GameMsg>> Room::GetOpponent(uint32_t clientID) const
+{
+    for (auto& slot : m_Players)
+    {
+        if (slot && slot->GetID() != clientID)
+            return slot;
+    }
+    return nullptr;
+}
+
+size_t Room::GetSlot(uint32_t clientID) const
+{
+    for (size_t i = 0; i < ROOM_CAPACITY; ++i)
+    {
+        if (m_Players[i] && m_Players[i]->GetID() == clientID)
+            return i;
+    }
+    return ROOM_CAPACITY;
+}
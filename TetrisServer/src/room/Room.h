@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../common/PacketProtocol.h"
+#include "PlayerSim.h"
+
+// -----------------------------
+// 1:1 대전 방 하나
+//  - 자신을 맡은 RoomWorker 스레드에서만 접근 (락 없음)
+//  - Relay         : 게임 패킷은 같은 방의 상대에게만 전달
+//  - Authoritative : 입력만 받아 플레이어별 PlayerSim 으로 진행, 검증한 입력을 상대에게 중계
+// -----------------------------
+class Room
+{
+public:
+    static constexpr size_t ROOM_CAPACITY = 2;
+
+    enum class RoomState
+    {
+        Waiting,    // 상대 대기 중
+        Playing,    // 시드 전송 완료, 게임 진행 중
+        Finished    // GameOver 전송 완료, 플레이어 퇴장만 남음
+    };
+
+    static constexpr int AUTH_TICK_MS = 100;    // 권한 모드에서 보고가 끊긴 플레이어를 진행시키는 주기
+
+public:
+    Room(uint32_t nRoomID, uint64_t nSeed, NetSyncMode syncMode);
+
+    void AddPlayer(std::shared_ptr<sp::net::connection<GameMsg>> client);
+    void RemovePlayer(uint32_t clientID);
+    void HandleMessage(const std::shared_ptr<sp::net::connection<GameMsg>>& client, sp::net::message<GameMsg>& msg);
+
+    // 권한 모드 주기 진행 (RoomWorker 가 AUTH_TICK_MS 마다 호출)
+    void Tick(std::chrono::steady_clock::time_point now);
+
+    const uint32_t GetID() const { return m_nRoomID; }
+    const RoomState GetState() const { return m_State; }
+    const NetSyncMode GetSyncMode() const { return m_SyncMode; }
+    const size_t GetPlayerCount() const;
+    const bool IsEmpty() const { return GetPlayerCount() == 0; }
+
+private:
+    void StartGame();
+    void FinishGame(uint32_t winnerID, uint32_t loserID);
+
+    // 권한 모드
+    void HandleAuthoritativeMessage(size_t nSlot, sp::net::message<GameMsg>& msg);
+    void ApplyInputBatch(size_t nSlot, sp::net::message<GameMsg>& msg);
+    void FlushSims();
+    uint64_t GetServerTick(std::chrono::steady_clock::time_point now) const;
+
+    void SendToAll(sp::net::message<GameMsg>&& msg);
+    std::shared_ptr<sp::net::connection<GameMsg>> GetOpponent(uint32_t clientID) const;
+    size_t GetSlot(uint32_t clientID) const;
+
+private:
+    uint32_t m_nRoomID = 0;
+    uint64_t m_nSeed = 0;
+    RoomState m_State = RoomState::Waiting;
+    NetSyncMode m_SyncMode = NetSyncMode::Relay;
+
+    std::array<std::shared_ptr<sp::net::connection<GameMsg>>, ROOM_CAPACITY> m_Players{};
+
+    // --- 권한 모드 (m_Players 와 같은 슬롯) ---
+    std::array<std::unique_ptr<PlayerSim>, ROOM_CAPACITY> m_Sims{};
+    std::chrono::steady_clock::time_point m_StartTime{};     // 서버 tick 0
+    std::vector<sp::net::message<GameMsg>> m_vSyncMessages;  // FlushSims 에서 재사용
+};
@@ -0,0 +1,67 @@
+#include "RoomManager.h"
+#include <iostream>
+
+RoomManager::RoomManager(size_t nWorkers, NetSyncMode syncMode)
+{
+    nWorkers = std::max<size_t>(nWorkers, 1);
+
+    for (size_t i = 0; i < nWorkers; ++i)
+        m_vWorkers.push_back(std::make_unique<RoomWorker>(i, syncMode));
+}
+
+RoomManager::~RoomManager()
+{
+    Stop();
+}
+
+void RoomManager::Start()
+{
+    for (auto& worker : m_vWorkers)
+        worker->Start();
+}
+
+void RoomManager::Stop()
+{
+    for (auto& worker : m_vWorkers)
+        worker->Stop();
+}
+
+void RoomManager::CreateRoom(std::shared_ptr<sp::net::connection<GameMsg>> first, std::shared_ptr<sp::net::connection<GameMsg>> second)
+{
+    const uint32_t roomID = m_nRoomIDCounter++;
+    RoomWorker& worker = GetWorker(roomID);
+
+    for (auto* client : { &first, &second })
+    {
+        m_mapClientRoom[(*client)->GetID()] = roomID;
+        worker.Post({ RoomEventType::Join, roomID, std::move(*client) });
+    }
+}
+
+void RoomManager::LeaveRoom(const std::shared_ptr<sp::net::connection<GameMsg>>& client)
+{
+    auto it = m_mapClientRoom.find(client->GetID());
+    if (it == m_mapClientRoom.end())
+        return;
+
+    const uint32_t roomID = it->second;
+    m_mapClientRoom.erase(it);
+
+    GetWorker(roomID).Post({ RoomEventType::Leave, roomID, client });
+}
+
+bool RoomManager::RouteMessage(const std::shared_ptr<sp::net::connection<GameMsg>>& client, sp::net::message<GameMsg>&& msg)
+{
+    auto it = m_mapClientRoom.find(client->GetID());
+    if (it == m_mapClientRoom.end())
+        return false;
+
+    const uint32_t roomID = it->second;
+    GetWorker(roomID).Post({ RoomEventType::Message, roomID, client, std::move(msg) });
+    return true;
+}
+
+RoomWorker& RoomManager::GetWorker(uint32_t roomID)
+{
+    return *m_vWorkers[roomID % m_vWorkers.size()];
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RoomWorker.h"
+
+// -----------------------------
+// 방 배정 / 라우팅 (메인 스레드 전용)
+//  - 방 ID 로 워커를 고정 (roomID % 워커 수) → 한 방의 이벤트는 항상 같은 스레드에서 순서대로 처리
+//  - 메인 스레드는 누가 어느 방에 있는지만 알고, 방 상태는 워커만 가짐
+// -----------------------------
+class RoomManager
+{
+public:
+    RoomManager(size_t nWorkers, NetSyncMode syncMode);
+    ~RoomManager();
+
+    void Start();
+    void Stop();
+
+    // 매칭된 두 명으로 새 방을 만듦 (워커가 RoomJoinAccepted / 시드 / AllPlayersReady 전송)
+    void CreateRoom(std::shared_ptr<sp::net::connection<GameMsg>> first, std::shared_ptr<sp::net::connection<GameMsg>> second);
+    void LeaveRoom(const std::shared_ptr<sp::net::connection<GameMsg>>& client);
+
+    // 방에 속한 클라이언트면 그 방 워커로 넘기고 true
+    bool RouteMessage(const std::shared_ptr<sp::net::connection<GameMsg>>& client, sp::net::message<GameMsg>&& msg);
+
+    const bool IsInRoom(uint32_t clientID) const { return m_mapClientRoom.count(clientID) > 0; }
+    const size_t GetWorkerCount() const { return m_vWorkers.size(); }
+
+private:
+    RoomWorker& GetWorker(uint32_t roomID);
+
+private:
+    std::vector<std::unique_ptr<RoomWorker>> m_vWorkers;
+
+    std::unordered_map<uint32_t, uint32_t> m_mapClientRoom;     // clientID → roomID
+
+    uint32_t m_nRoomIDCounter = 1;
+};
@@ -0,0 +1,126 @@
+#include "RoomWorker.h"
+#include <iostream>
+#include <random>
+
+RoomWorker::RoomWorker(size_t nIndex, NetSyncMode syncMode)
+    : m_nIndex(nIndex)
+    , m_SyncMode(syncMode)
+{
+}
+
+RoomWorker::~RoomWorker()
+{
+    Stop();
+}
+
+void RoomWorker::Start()
+{
+    if (m_bRunning.exchange(true))
+        return;
+
+    m_Thread = std::thread([this]() { Run(); });
+}
+
+void RoomWorker::Stop()
+{
+    if (!m_bRunning.exchange(false))
+        return;
+
+    m_qEvents.notify();
+
+    if (m_Thread.joinable())
+        m_Thread.join();
+}
+
+void RoomWorker::Post(sRoomEvent&& ev)
+{
+    m_qEvents.push_back(std::move(ev));
+}
+
+void RoomWorker::Run()
+{
+    while (m_bRunning)
+    {
+        const bool bTicking = m_SyncMode == NetSyncMode::Authoritative && !m_mapRooms.empty();
+
+        if (bTicking)
+            m_qEvents.wait_until(m_NextTickTime);
+        else
+            m_qEvents.wait();
+
+        m_qEvents.drain_into(m_vEvents);
+
+        for (auto& ev : m_vEvents)
+            ProcessEvent(ev);
+
+        m_vEvents.clear();
+
+        if (m_SyncMode == NetSyncMode::Authoritative)
+            TickRooms();
+    }
+}
+
+void RoomWorker::ProcessEvent(sRoomEvent& ev)
+{
+    switch (ev.type)
+    {
+        case RoomEventType::Join:
+        {
+            auto it = m_mapRooms.find(ev.roomID);
+            if (it == m_mapRooms.end())
+            {
+                it = m_mapRooms.try_emplace(ev.roomID, ev.roomID, GenerateSeed(), m_SyncMode).first;
+                std::cout << "[Worker " << m_nIndex << "] Room Created " << ev.roomID << "\n";
+            }
+
+            it->second.AddPlayer(std::move(ev.client));
+            break;
+        }
+
+        case RoomEventType::Leave:
+        {
+            auto it = m_mapRooms.find(ev.roomID);
+            if (it == m_mapRooms.end())
+                break;
+
+            it->second.RemovePlayer(ev.client->GetID());
+
+            // 마지막 플레이어가 나가면 방 제거
+            if (it->second.IsEmpty())
+            {
+                m_mapRooms.erase(it);
+                std::cout << "[Worker " << m_nIndex << "] Room Closed " << ev.roomID << "\n";
+            }
+            break;
+        }
+
+        case RoomEventType::Message:
+        {
+            auto it = m_mapRooms.find(ev.roomID);
+            if (it != m_mapRooms.end())
+                it->second.HandleMessage(ev.client, ev.msg);
+            break;
+        }
+    }
+}
+
+void RoomWorker::TickRooms()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now < m_NextTickTime)
+        return;
+
+    for (auto& [roomID, room] : m_mapRooms)
+        room.Tick(now);
+
+    m_NextTickTime = now + std::chrono::milliseconds(Room::AUTH_TICK_MS);
+}
+
+uint64_t RoomWorker::GenerateSeed()
+{
+    uint64_t rd = ((uint64_t)std::random_device{}() << 32)
+        ^ (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count()
+        ^ (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+
+    return rd;
+}
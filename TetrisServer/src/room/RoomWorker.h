@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Room.h"
+
+// -----------------------------
+// 메인 스레드 → RoomWorker 이벤트
+// -----------------------------
+enum class RoomEventType
+{
+    Join,       // client 를 roomID 방에 넣음 (방이 없으면 생성)
+    Leave,      // client 가 roomID 방에서 나감
+    Message     // client 가 보낸 게임 패킷
+};
+
+struct sRoomEvent
+{
+    RoomEventType type{};
+    uint32_t roomID{};
+    std::shared_ptr<sp::net::connection<GameMsg>> client;
+    sp::net::message<GameMsg> msg{};
+};
+
+// -----------------------------
+// 방 묶음 하나를 전담하는 스레드
+//  - 방은 생성부터 제거까지 한 워커에만 속하므로 방 상태에 락이 필요 없음
+//  - Post 는 메인 스레드에서, 나머지는 워커 스레드에서 실행
+//  - 권한 모드에서는 방이 있는 동안 Room::AUTH_TICK_MS 마다 깨어나 Room::Tick 호출
+// -----------------------------
+class RoomWorker
+{
+public:
+    RoomWorker(size_t nIndex, NetSyncMode syncMode);
+    ~RoomWorker();
+
+    RoomWorker(const RoomWorker&) = delete;
+    RoomWorker& operator=(const RoomWorker&) = delete;
+
+    void Start();
+    void Stop();
+
+    void Post(sRoomEvent&& ev);
+
+private:
+    void Run();
+    void ProcessEvent(sRoomEvent& ev);
+    void TickRooms();
+
+    static uint64_t GenerateSeed();
+
+private:
+    size_t m_nIndex = 0;
+    NetSyncMode m_SyncMode = NetSyncMode::Relay;
+
+    sp::net::tsqueue<sRoomEvent> m_qEvents;
+    std::vector<sRoomEvent> m_vEvents;              // Run 에서 재사용
+
+    std::unordered_map<uint32_t, Room> m_mapRooms;
+    std::chrono::steady_clock::time_point m_NextTickTime{};
+
+    std::thread m_Thread;
+    std::atomic<bool> m_bRunning{ false };
+};
@@ -0,0 +1,52 @@
+﻿#include "SimPolicy.h"
+#include "engine/GameEngine.h"
+#include "engine/EngineTypes.h"
+
+using namespace Tetris;
+
+void RandomDropPolicy::Reset(uint64_t seed)
+{
+	// 미노 순서(BagRandom)와 다른 수열을 쓰도록 시드를 섞어줌
+	m_Random.Reseed(seed * 0x9E3779B97F4A7C15ull + 1);
+	m_PlannedPiece = -1;
+}
+
+uint8_t RandomDropPolicy::NextInputs(const GameEngine& engine)
+{
+	// 새 피스가 스폰되면 목표 회전/이동량을 새로 정함
+	if (m_PlannedPiece != engine.GetTotalPieces())
+	{
+		m_PlannedPiece = engine.GetTotalPieces();
+		m_RotationsLeft = m_Random.Range<int>(0, Tetris::ROTATION_COUNT - 1);
+		m_ShiftLeft = m_Random.Range<int>(-BOARD_WIDTH / 2, BOARD_WIDTH / 2);
+	}
+
+	if (m_RotationsLeft > 0)
+	{
+		--m_RotationsLeft;
+		return INPUT_ROTATE_CW;
+	}
+
+	// 벽에 막혀도 남은 횟수만 소모하고 진행
+	if (m_ShiftLeft < 0)
+	{
+		++m_ShiftLeft;
+		return INPUT_LEFT;
+	}
+
+	if (m_ShiftLeft > 0)
+	{
+		--m_ShiftLeft;
+		return INPUT_RIGHT;
+	}
+
+	return INPUT_HARD_DROP;
+}
+
+std::unique_ptr<ISimPolicy> CreateSimPolicy(std::string_view name)
+{
+	if (name == "random")
+		return std::make_unique<RandomDropPolicy>();
+
+	return nullptr;
+}
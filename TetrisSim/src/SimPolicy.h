@@ -0,0 +1,42 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include "utils/Random.h"
+
+class GameEngine;
+
+// --------------------------------------------------------------------
+//  시뮬레이션에서 매 Step 마다 입력을 결정하는 정책
+//  워커마다 인스턴스를 하나씩 만들어 쓰므로 내부 상태를 가져도 됨
+// --------------------------------------------------------------------
+class ISimPolicy
+{
+public:
+	virtual ~ISimPolicy() = default;
+
+	// 새 게임 시작 (같은 시드면 같은 선택을 하도록 재시드)
+	virtual void Reset(uint64_t seed) = 0;
+
+	// 다음 Step 에 적용할 Tetris::InputFlag 조합
+	virtual uint8_t NextInputs(const GameEngine& engine) = 0;
+};
+
+// 피스마다 임의의 회전/열을 골라 하드 드롭 (기준선 측정용)
+class RandomDropPolicy final : public ISimPolicy
+{
+public:
+	void Reset(uint64_t seed) override;
+	uint8_t NextInputs(const GameEngine& engine) override;
+
+private:
+	Random m_Random{};
+
+	int m_PlannedPiece{ -1 };
+	int m_RotationsLeft{ 0 };
+	int m_ShiftLeft{ 0 };
+};
+
+// 이름으로 정책 생성 (알 수 없는 이름이면 nullptr)
+std::unique_ptr<ISimPolicy> CreateSimPolicy(std::string_view name);
@@ -0,0 +1,75 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <algorithm>
+
+// --------------------------------------------------------------------
+//  한 게임의 결과 (바이너리 출력 시 레코드 하나)
+// --------------------------------------------------------------------
+#pragma pack(push, 1)
+struct sSimResult
+{
+	uint64_t seed{ 0 };
+	uint64_t ticks{ 0 };		// 게임 종료까지 진행된 엔진 tick
+	uint32_t score{ 0 };
+	uint32_t lines{ 0 };
+	uint32_t pieces{ 0 };
+	uint16_t level{ 0 };
+	uint8_t  bTopOut{ 0 };		// 1: 탑아웃, 0: 피스 제한 도달
+	uint8_t  reserved{ 0 };
+};
+#pragma pack(pop)
+
+static_assert(sizeof(sSimResult) == 32, "sSimResult must stay 32 bytes (binary output format)");
+
+// --------------------------------------------------------------------
+//  워커별 누적 통계 (false sharing 방지를 위해 캐시라인 정렬)
+//  워커는 자기 슬롯만 갱신하고, 모든 게임이 끝난 뒤 메인 스레드가 Merge
+// --------------------------------------------------------------------
+struct alignas(64) sSimStats
+{
+	uint64_t games{ 0 };
+	uint64_t topOuts{ 0 };
+
+	uint64_t totalScore{ 0 };
+	uint64_t totalLines{ 0 };
+	uint64_t totalPieces{ 0 };
+	uint64_t totalLevel{ 0 };
+	uint64_t totalTicks{ 0 };
+
+	uint32_t maxScore{ 0 };
+	uint32_t maxLines{ 0 };
+	uint16_t maxLevel{ 0 };
+
+	void Add(const sSimResult& r)
+	{
+		++games;
+		topOuts += r.bTopOut;
+
+		totalScore += r.score;
+		totalLines += r.lines;
+		totalPieces += r.pieces;
+		totalLevel += r.level;
+		totalTicks += r.ticks;
+
+		maxScore = std::max(maxScore, r.score);
+		maxLines = std::max(maxLines, r.lines);
+		maxLevel = std::max(maxLevel, r.level);
+	}
+
+	void Merge(const sSimStats& other)
+	{
+		games += other.games;
+		topOuts += other.topOuts;
+
+		totalScore += other.totalScore;
+		totalLines += other.totalLines;
+		totalPieces += other.totalPieces;
+		totalLevel += other.totalLevel;
+		totalTicks += other.totalTicks;
+
+		maxScore = std::max(maxScore, other.maxScore);
+		maxLines = std::max(maxLines, other.maxLines);
+		maxLevel = std::max(maxLevel, other.maxLevel);
+	}
+};
@@ -0,0 +1,90 @@
+﻿#define _CRT_SECURE_NO_WARNINGS
+
+#include "SimWriter.h"
+#include <cinttypes>
+
+SimWriter::~SimWriter()
+{
+	Close();
+}
+
+bool SimWriter::Open(const std::string& path, SimOutputFormat format)
+{
+	Close();
+
+	m_File = std::fopen(path.c_str(), format == SimOutputFormat::Binary ? "wb" : "w");
+	if (!m_File)
+		return false;
+
+	m_Format = format;
+	m_RecordCount = 0;
+
+	// 대용량 출력이므로 stdio 버퍼를 크게 잡음
+	std::setvbuf(m_File, nullptr, _IOFBF, 1 << 20);
+
+	if (m_Format == SimOutputFormat::Binary)
+	{
+		sSimFileHeader header;
+		std::fwrite(&header, sizeof(header), 1, m_File);
+	}
+	else
+	{
+		std::fputs("seed,score,lines,pieces,level,ticks,topout\n", m_File);
+	}
+
+	return true;
+}
+
+void SimWriter::Close()
+{
+	if (!m_File)
+		return;
+
+	// 헤더의 레코드 수 갱신
+	if (m_Format == SimOutputFormat::Binary)
+	{
+		sSimFileHeader header;
+		header.recordCount = m_RecordCount;
+
+		std::fseek(m_File, 0, SEEK_SET);
+		std::fwrite(&header, sizeof(header), 1, m_File);
+	}
+
+	std::fclose(m_File);
+	m_File = nullptr;
+}
+
+void SimWriter::Append(const sSimResult* results, size_t count)
+{
+	if (!m_File || count == 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(m_Lock);
+
+	if (m_Format == SimOutputFormat::Binary)
+		std::fwrite(results, sizeof(sSimResult), count, m_File);
+	else
+		WriteCsv(results, count);
+
+	m_RecordCount += count;
+}
+
+void SimWriter::WriteCsv(const sSimResult* results, size_t count)
+{
+	// 레코드 한 줄 최대 길이: 20*2 + 10*3 + 5 + 1 + 구분자
+	constexpr size_t MAX_LINE = 96;
+	m_TextBuffer.resize(count * MAX_LINE);
+
+	char* out = m_TextBuffer.data();
+	for (size_t i = 0; i < count; ++i)
+	{
+		const sSimResult& r = results[i];
+		const int written = std::snprintf(out, MAX_LINE, "%" PRIu64 ",%u,%u,%u,%u,%" PRIu64 ",%u\n",
+			r.seed, r.score, r.lines, r.pieces, static_cast<unsigned>(r.level), r.ticks, static_cast<unsigned>(r.bTopOut));
+
+		if (written > 0)
+			out += written;
+	}
+
+	std::fwrite(m_TextBuffer.data(), 1, static_cast<size_t>(out - m_TextBuffer.data()), m_File);
+}
@@ -0,0 +1,62 @@
+﻿#pragma once
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "SimTypes.h"
+
+enum class SimOutputFormat
+{
+	Csv,
+	Binary
+};
+
+// --------------------------------------------------------------------
+//  결과 스트리밍 출력
+//  워커는 결과를 자기 버퍼에 모았다가 가득 차면 Append 로 한 번에 기록
+//  (파일 쓰기만 직렬화, 통계 집계와 게임 진행에는 락이 없음)
+//
+//  바이너리 포맷: sSimFileHeader + sSimResult * count (little-endian)
+//  레코드는 워커 완료 순서대로 기록되므로 seed 로 식별
+// --------------------------------------------------------------------
+#pragma pack(push, 1)
+struct sSimFileHeader
+{
+	char magic[4]{ 'T', 'S', 'I', 'M' };
+	uint16_t version{ 1 };
+	uint16_t recordSize{ sizeof(sSimResult) };
+	uint64_t recordCount{ 0 };		// Close 시 갱신
+};
+#pragma pack(pop)
+
+class SimWriter
+{
+public:
+	SimWriter() = default;
+	~SimWriter();
+
+	SimWriter(const SimWriter&) = delete;
+	SimWriter& operator=(const SimWriter&) = delete;
+
+	bool Open(const std::string& path, SimOutputFormat format);
+	void Close();
+
+	const bool IsOpen() const { return m_File != nullptr; }
+
+	// 여러 워커에서 동시에 호출 가능
+	void Append(const sSimResult* results, size_t count);
+
+private:
+	void WriteCsv(const sSimResult* results, size_t count);
+
+private:
+	std::FILE* m_File{ nullptr };
+	SimOutputFormat m_Format{ SimOutputFormat::Csv };
+
+	std::mutex m_Lock;
+	uint64_t m_RecordCount{ 0 };
+
+	// CSV 변환용 (m_Lock 보호)
+	std::vector<char> m_TextBuffer;
+};
@@ -0,0 +1,117 @@
+﻿#include "Simulator.h"
+#include "SimPolicy.h"
+#include "WorkStealingScheduler.h"
+#include "engine/GameEngine.h"
+#include "utils/Logger.h"
+#include <thread>
+
+namespace
+{
+	// 워커별 결과 버퍼 크기 (가득 차면 한 번에 파일로)
+	constexpr size_t FLUSH_RECORDS = 4096;
+
+	// 정책이 하드 드롭을 하지 않아도 끝나도록 피스당 Step 상한
+	constexpr uint64_t MAX_STEPS_PER_PIECE = 4096;
+}
+
+Simulator::Simulator(const sSimOptions& options)
+	: m_Options{ options }
+	, m_ThreadCount{ options.threads }
+{
+	if (m_ThreadCount == 0)
+		m_ThreadCount = std::max(1u, std::thread::hardware_concurrency());
+}
+
+Simulator::~Simulator() = default;
+
+bool Simulator::Run()
+{
+	// 정책 이름 검증
+	if (!CreateSimPolicy(m_Options.policy))
+	{
+		TETRIS_ERROR("Unknown policy: " + m_Options.policy);
+		return false;
+	}
+
+	if (!m_Options.outPath.empty() && !m_Writer.Open(m_Options.outPath, m_Options.format))
+	{
+		TETRIS_ERROR("Failed to open output: " + m_Options.outPath);
+		return false;
+	}
+
+	std::vector<sWorkerContext> workers(m_ThreadCount);
+	for (auto& ctx : workers)
+	{
+		ctx.engine = std::make_unique<GameEngine>(m_Options.baseSeed);
+		ctx.policy = CreateSimPolicy(m_Options.policy);
+		ctx.pending.reserve(FLUSH_RECORDS);
+	}
+
+	WorkStealingScheduler scheduler(m_ThreadCount);
+	scheduler.Run(m_Options.games, [this, &workers](unsigned worker, uint32_t index)
+	{
+		sWorkerContext& ctx = workers[worker];
+
+		const uint64_t seed = m_Options.baseSeed + index;
+		const sSimResult result = PlayGame(*ctx.engine, *ctx.policy, seed, m_Options.maxPieces, m_Options.ticksPerStep);
+
+		ctx.stats.Add(result);
+
+		if (m_Writer.IsOpen())
+		{
+			ctx.pending.push_back(result);
+			if (ctx.pending.size() >= FLUSH_RECORDS)
+				FlushPending(ctx);
+		}
+	});
+
+	// 워커별 통계 병합 (모든 워커 종료 후라 동기화 불필요)
+	m_Stats = {};
+	for (auto& ctx : workers)
+	{
+		FlushPending(ctx);
+		m_Stats.Merge(ctx.stats);
+	}
+
+	m_StealCount = scheduler.GetStealCount();
+	m_Writer.Close();
+
+	return true;
+}
+
+sSimResult Simulator::PlayGame(GameEngine& engine, ISimPolicy& policy, uint64_t seed, uint32_t maxPieces, uint32_t ticksPerStep)
+{
+	engine.Reset(seed);
+	policy.Reset(seed);
+
+	const uint64_t maxSteps = static_cast<uint64_t>(maxPieces + 1) * MAX_STEPS_PER_PIECE;
+	uint64_t steps = 0;
+
+	while (!engine.IsGameOver() && static_cast<uint32_t>(engine.GetTotalPieces()) < maxPieces && steps < maxSteps)
+	{
+		engine.Step(policy.NextInputs(engine), ticksPerStep);
+
+		// 시뮬레이션에서는 이벤트를 쓰지 않으므로 매 Step 비움
+		engine.ClearEvents();
+		++steps;
+	}
+
+	const Score& score = engine.GetScore();
+
+	sSimResult result;
+	result.seed = seed;
+	result.ticks = engine.GetTick();
+	result.score = static_cast<uint32_t>(score.GetScore());
+	result.lines = static_cast<uint32_t>(score.GetLines());
+	result.pieces = static_cast<uint32_t>(engine.GetTotalPieces());
+	result.level = static_cast<uint16_t>(score.GetLevel());
+	result.bTopOut = engine.IsGameOver() ? 1 : 0;
+
+	return result;
+}
+
+void Simulator::FlushPending(sWorkerContext& ctx)
+{
+	m_Writer.Append(ctx.pending.data(), ctx.pending.size());
+	ctx.pending.clear();
+}
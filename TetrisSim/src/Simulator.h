@@ -0,0 +1,64 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "SimTypes.h"
+#include "SimWriter.h"
+
+class GameEngine;
+class ISimPolicy;
+
+struct sSimOptions
+{
+	uint32_t games{ 1000 };
+	uint64_t baseSeed{ 1 };			// i 번째 게임 시드: baseSeed + i (0 은 시간 기반이므로 사용 안 함)
+	unsigned threads{ 0 };			// 0: 하드웨어 스레드 수
+	uint32_t maxPieces{ 1000 };		// 게임당 최대 피스 수 (탑아웃 안 해도 종료)
+	uint32_t ticksPerStep{ 16 };	// Step 한 번에 진행할 tick (16 ≒ 60fps)
+
+	std::string policy{ "random" };
+
+	std::string outPath{};			// 비어 있으면 파일 출력 없음
+	SimOutputFormat format{ SimOutputFormat::Csv };
+};
+
+// --------------------------------------------------------------------
+//  시드별 독립 게임을 모든 코어에서 실행하고 결과를 집계/출력
+// --------------------------------------------------------------------
+class Simulator
+{
+public:
+	explicit Simulator(const sSimOptions& options);
+	~Simulator();
+
+	bool Run();
+
+	const sSimStats& GetStats() const { return m_Stats; }
+	const unsigned GetThreadCount() const { return m_ThreadCount; }
+	const uint64_t GetStealCount() const { return m_StealCount; }
+
+	// 엔진 하나로 게임 하나를 끝까지 진행 (엔진/정책은 시드로 재초기화)
+	static sSimResult PlayGame(GameEngine& engine, ISimPolicy& policy, uint64_t seed, uint32_t maxPieces, uint32_t ticksPerStep);
+
+private:
+	// 워커 전용 상태 (다른 워커와 공유하지 않음)
+	struct alignas(64) sWorkerContext
+	{
+		std::unique_ptr<GameEngine> engine;
+		std::unique_ptr<ISimPolicy> policy;
+		std::vector<sSimResult> pending;
+		sSimStats stats;
+	};
+
+	void FlushPending(sWorkerContext& ctx);
+
+private:
+	sSimOptions m_Options;
+	unsigned m_ThreadCount{ 1 };
+
+	SimWriter m_Writer;
+	sSimStats m_Stats{};
+	uint64_t m_StealCount{ 0 };
+};
@@ -0,0 +1,108 @@
+﻿#include "WorkStealingScheduler.h"
+#include <thread>
+#include <vector>
+
+WorkStealingScheduler::WorkStealingScheduler(unsigned threadCount)
+	: m_ThreadCount{ threadCount }
+{
+	if (m_ThreadCount == 0)
+		m_ThreadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	m_Ranges = std::make_unique<sWorkRange[]>(m_ThreadCount);
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() = default;
+
+void WorkStealingScheduler::Run(uint32_t count, const std::function<void(unsigned, uint32_t)>& fn)
+{
+	if (count == 0)
+		return;
+
+	m_StealCount.store(0, std::memory_order_relaxed);
+
+	// 초기 분배: 균등 분할 (나머지는 앞쪽 워커에 하나씩)
+	const uint32_t base = count / m_ThreadCount;
+	const uint32_t extra = count % m_ThreadCount;
+
+	uint32_t begin = 0;
+	for (unsigned w = 0; w < m_ThreadCount; ++w)
+	{
+		const uint32_t size = base + (w < extra ? 1 : 0);
+		m_Ranges[w].range.store(Pack(begin, begin + size), std::memory_order_relaxed);
+		begin += size;
+	}
+
+	// 메인 스레드도 워커 0 으로 참여
+	std::vector<std::thread> threads;
+	threads.reserve(m_ThreadCount - 1);
+
+	for (unsigned w = 1; w < m_ThreadCount; ++w)
+		threads.emplace_back([this, w, &fn] { WorkerLoop(w, fn); });
+
+	WorkerLoop(0, fn);
+
+	for (auto& t : threads)
+		t.join();
+}
+
+void WorkStealingScheduler::WorkerLoop(unsigned worker, const std::function<void(unsigned, uint32_t)>& fn)
+{
+	uint32_t item = 0;
+
+	while (true)
+	{
+		while (PopLocal(worker, item))
+			fn(worker, item);
+
+		// 남은 일이 있는 워커가 없으면 종료
+		// (구간에 1개만 남은 워커는 곧 직접 처리하므로 훔치지 않음)
+		if (!Steal(worker))
+			break;
+	}
+}
+
+bool WorkStealingScheduler::PopLocal(unsigned worker, uint32_t& outItem)
+{
+	auto& slot = m_Ranges[worker].range;
+	uint64_t cur = slot.load(std::memory_order_acquire);
+
+	while (Begin(cur) < End(cur))
+	{
+		// 앞쪽 하나 가져가기 (동시에 뒤쪽이 steal 될 수 있으므로 CAS)
+		if (slot.compare_exchange_weak(cur, Pack(Begin(cur) + 1, End(cur)), std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			outItem = Begin(cur);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool WorkStealingScheduler::Steal(unsigned thief)
+{
+	// 자기 다음 워커부터 순회하여 특정 워커에 steal 이 몰리지 않도록 함
+	for (unsigned i = 1; i < m_ThreadCount; ++i)
+	{
+		const unsigned victim = (thief + i) % m_ThreadCount;
+		auto& slot = m_Ranges[victim].range;
+
+		uint64_t cur = slot.load(std::memory_order_acquire);
+		while (End(cur) - Begin(cur) >= 2)
+		{
+			const uint32_t b = Begin(cur);
+			const uint32_t e = End(cur);
+			const uint32_t mid = b + (e - b) / 2;
+
+			if (slot.compare_exchange_weak(cur, Pack(b, mid), std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				// 자기 구간은 비어 있으므로 다른 워커가 건드리지 않음
+				m_Ranges[thief].range.store(Pack(mid, e), std::memory_order_release);
+				m_StealCount.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,55 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+// --------------------------------------------------------------------
+//  [0, count) 인덱스를 워커 수만큼 나눠 실행하는 work-stealing 스케줄러
+//
+//  각 워커는 자기 구간 [begin, end) 을 앞에서부터 하나씩 꺼내 실행하고,
+//  구간이 비면 다른 워커 구간의 뒤쪽 절반을 훔쳐온다.
+//  구간은 (begin, end) 를 64비트 하나로 묶어 CAS 로만 갱신하므로 락이 없다.
+//  게임마다 길이가 크게 달라도 먼저 끝난 워커가 남은 일을 가져가 균형이 맞춰짐
+// --------------------------------------------------------------------
+class WorkStealingScheduler
+{
+public:
+	// 0: 하드웨어 스레드 수 사용
+	explicit WorkStealingScheduler(unsigned threadCount = 0);
+	~WorkStealingScheduler();
+
+	// fn(workerIndex, itemIndex) 를 모든 인덱스에 대해 한 번씩 실행 (완료까지 블록)
+	void Run(uint32_t count, const std::function<void(unsigned, uint32_t)>& fn);
+
+	const unsigned GetThreadCount() const { return m_ThreadCount; }
+
+	// 디버그/튜닝용: 마지막 Run 에서 성공한 steal 횟수
+	const uint64_t GetStealCount() const { return m_StealCount.load(std::memory_order_relaxed); }
+
+private:
+	struct alignas(64) sWorkRange
+	{
+		// 상위 32비트: begin, 하위 32비트: end
+		std::atomic<uint64_t> range{ 0 };
+	};
+
+	static constexpr uint64_t Pack(uint32_t begin, uint32_t end) { return (static_cast<uint64_t>(begin) << 32) | end; }
+	static constexpr uint32_t Begin(uint64_t packed) { return static_cast<uint32_t>(packed >> 32); }
+	static constexpr uint32_t End(uint64_t packed) { return static_cast<uint32_t>(packed); }
+
+	void WorkerLoop(unsigned worker, const std::function<void(unsigned, uint32_t)>& fn);
+
+	// 자기 구간 앞쪽에서 하나 꺼내기
+	bool PopLocal(unsigned worker, uint32_t& outItem);
+
+	// 다른 워커 구간의 뒤쪽 절반을 가져와 자기 구간으로 설정
+	bool Steal(unsigned thief);
+
+private:
+	unsigned m_ThreadCount{ 1 };
+	std::unique_ptr<sWorkRange[]> m_Ranges;
+
+	std::atomic<uint64_t> m_StealCount{ 0 };
+};
@@ -0,0 +1,134 @@
+﻿#include "Simulator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+	void PrintUsage()
+	{
+		std::printf(
+			"usage: tetris_sim [options]\n"
+			"  --games N        number of games (default 1000)\n"
+			"  --seed S         base seed, game i uses S + i (default 1)\n"
+			"  --threads T      worker threads, 0 = all cores (default 0)\n"
+			"  --max-pieces P   piece limit per game (default 1000)\n"
+			"  --tick MS        engine ticks per step (default 16)\n"
+			"  --policy NAME    input policy: random (default random)\n"
+			"  --out PATH       stream per-game results to PATH\n"
+			"  --format F       csv | bin (default csv)\n");
+	}
+
+	bool ParseArgs(int argc, char* argv[], sSimOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const char* arg = argv[i];
+			const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+			auto need = [&]() -> bool
+			{
+				if (!value)
+				{
+					std::fprintf(stderr, "missing value for %s\n", arg);
+					return false;
+				}
+				++i;
+				return true;
+			};
+
+			if (std::strcmp(arg, "--games") == 0)
+			{
+				if (!need()) return false;
+				options.games = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--seed") == 0)
+			{
+				if (!need()) return false;
+				options.baseSeed = std::strtoull(value, nullptr, 10);
+			}
+			else if (std::strcmp(arg, "--threads") == 0)
+			{
+				if (!need()) return false;
+				options.threads = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--max-pieces") == 0)
+			{
+				if (!need()) return false;
+				options.maxPieces = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--tick") == 0)
+			{
+				if (!need()) return false;
+				options.ticksPerStep = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+			}
+			else if (std::strcmp(arg, "--policy") == 0)
+			{
+				if (!need()) return false;
+				options.policy = value;
+			}
+			else if (std::strcmp(arg, "--out") == 0)
+			{
+				if (!need()) return false;
+				options.outPath = value;
+			}
+			else if (std::strcmp(arg, "--format") == 0)
+			{
+				if (!need()) return false;
+
+				if (std::strcmp(value, "csv") == 0)
+					options.format = SimOutputFormat::Csv;
+				else if (std::strcmp(value, "bin") == 0)
+					options.format = SimOutputFormat::Binary;
+				else
+				{
+					std::fprintf(stderr, "unknown format: %s\n", value);
+					return false;
+				}
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		// 시드 0 은 BagRandom 에서 시간 기반 시드를 의미하므로 재현 불가
+		if (options.baseSeed == 0)
+			options.baseSeed = 1;
+
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	sSimOptions options;
+	if (!ParseArgs(argc, argv, options))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	Simulator sim(options);
+
+	const auto start = std::chrono::steady_clock::now();
+	if (!sim.Run())
+		return 1;
+	const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	const sSimStats& s = sim.GetStats();
+	const double games = s.games > 0 ? static_cast<double>(s.games) : 1.0;
+
+	std::printf("games      : %llu (%u threads, %llu steals, %.2fs, %.0f games/s)\n",
+		static_cast<unsigned long long>(s.games), sim.GetThreadCount(),
+		static_cast<unsigned long long>(sim.GetStealCount()), sec, s.games / (sec > 0.0 ? sec : 1.0));
+	std::printf("top out    : %llu\n", static_cast<unsigned long long>(s.topOuts));
+	std::printf("score      : avg %.1f / max %u\n", s.totalScore / games, s.maxScore);
+	std::printf("lines      : avg %.2f / max %u\n", s.totalLines / games, s.maxLines);
+	std::printf("pieces     : avg %.1f\n", s.totalPieces / games);
+	std::printf("level      : avg %.2f / max %u\n", s.totalLevel / games, static_cast<unsigned>(s.maxLevel));
+
+	return 0;
+}